@@ -296,6 +296,13 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the time until the next frame has to be shown, while the animation is playing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getTimeUntilUpdate(sf::Time& time) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // Draws the widget on the render target.
@@ -26,11 +26,11 @@
 #ifndef TGUI_CALLBACK_HPP
 #define TGUI_CALLBACK_HPP
 
-#include <map>
-#include <list>
+#include <vector>
 #include <functional>
 
 #include <TGUI/Global.hpp>
+#include <TGUI/Signal.hpp>
 #include <TGUI/SharedWidgetPtr.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +81,27 @@ namespace tgui
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CallbackManager();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Copy constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CallbackManager(const CallbackManager& copy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Overload of assignment operator
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CallbackManager& operator= (const CallbackManager& right);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Bind a function to one or more specific callback trigger(s).
         ///
@@ -117,7 +138,7 @@ namespace tgui
         template <typename T>
         void bindCallback(void (T::*func)(), T* const classPtr, unsigned int trigger)
         {
-            mapCallback(std::bind(func, classPtr), trigger);
+            mapCallback(std::bind(func, classPtr), trigger, false);
         }
 
 
@@ -156,7 +177,7 @@ namespace tgui
         template <typename T>
         void bindCallbackEx(void (T::*func)(const Callback&), T* const classPtr, unsigned int trigger)
         {
-            mapCallback(std::bind(func, classPtr, std::ref(m_Callback)), trigger);
+            mapCallback(std::bind(func, classPtr, std::ref(m_Callback)), trigger, true);
         }
 
 
@@ -200,14 +221,73 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Map the callback function to the needed trigger(s).
+        // When needsCallbackData is true then the function (or the parent) reads the m_Callback member.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mapCallback(const std::function<void()>& function, unsigned int trigger, bool needsCallbackData);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when a function (or the parent) is bound to the trigger. This only tests a bit in m_BoundTriggers.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCallbackBound(unsigned int trigger) const
+        {
+            return (m_BoundTriggers & trigger) != 0;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void mapCallback(const std::function<void()>& function, unsigned int trigger);
+        // Returns true when the only thing bound to the trigger is the parent (bindCallback without a function).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOnlyBoundToParent(unsigned int trigger) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when something bound to the trigger reads the data in m_Callback (a function bound with
+        // bindCallbackEx or the parent). Widgets only copy expensive data like text into m_Callback when this is true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCallbackDataNeeded(unsigned int trigger) const
+        {
+            return (m_CallbackDataTriggers & trigger) != 0;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the functions that were unbound and adds the ones that were bound while the callbacks were being sent.
+        // Called when the last function has returned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyDeferredBindings();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::map<unsigned int, std::list<std::function<void()>>> m_CallbackFunctions;
+        // A single function bound to a single trigger. An empty function means that the callback goes to the parent.
+        struct CallbackFunction
+        {
+            unsigned int          trigger;
+            std::function<void()> function;
+            unsigned int          unbound; // 0 while bound, otherwise the value of m_UnbindCount when it was unbound
+        };
+
+        // All bound functions in the order in which they were bound. Widgets rarely have more than a few of them,
+        // so a flat list is scanned faster than a map.
+        std::vector<CallbackFunction> m_CallbackFunctions;
+
+        // While callbacks are being sent, m_CallbackFunctions isn't changed because one of its functions is running.
+        // Functions that are bound in the meantime wait in this list, unbound functions are only marked.
+        std::vector<CallbackFunction> m_DeferredCallbackFunctions;
+
+        // How many callbacks are being sent (a function can cause another callback of the same widget)
+        unsigned int m_SendingCallbacks;
+
+        // Increased every time that functions are unbound while callbacks are being sent
+        unsigned int m_UnbindCount;
+
+        // A bit is set for every trigger that has at least one function bound to it
+        unsigned int m_BoundTriggers;
+
+        // A bit is set for every trigger that has a function bound to it which reads the data in m_Callback
+        unsigned int m_CallbackDataTriggers;
 
         Callback m_Callback;
 
@@ -481,6 +481,13 @@ namespace tgui
         virtual void initialize(Container *const container);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the area inside the borders on the render cache when the cache is enabled and outdated.
+        // The title bar and the borders are not cached, they are still drawn every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateRenderCaches();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         // Draws the widget on the render target.
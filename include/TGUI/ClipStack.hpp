@@ -0,0 +1,229 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_CLIP_STACK_HPP
+#define TGUI_CLIP_STACK_HPP
+
+
+#include <vector>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class RecordingTarget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Keeps track of the area in which the widgets are allowed to draw.
+    ///
+    /// Widgets that clip their contents push their area before drawing the contents and pop it afterwards. The area that
+    /// is pushed is intersected with the current one, so a widget can never draw outside its parents. The scissor box of
+    /// OpenGL is only changed when the resulting area really changes, and it is never read back from OpenGL.
+    ///
+    /// Containers also use the current area to skip the widgets that lie completely outside of it.
+    ///
+    /// The gui uses a clip stack while drawing its widgets, you only need this class when writing your own widgets.
+    /// A widget that clips its contents calls beginIfInactive first, so that it is also clipped when drawn without gui.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ClipStack : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ClipStack();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes this the active clip stack for the given target and enables clipping on the whole target.
+        ///
+        /// \param target  Render target on which the widgets will be drawn, it has to be the active OpenGL target
+        ///
+        /// The scissor test is disabled again when end is called.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes this the active clip stack for the given target and only lets the widgets draw inside the given area.
+        ///
+        /// \param target  Render target on which the widgets will be drawn, it has to be the active OpenGL target
+        /// \param area    Area in pixels, with the origin in the top left corner of the target
+        ///
+        /// Use this when the scissor test is already enabled on the target. When end is called, the scissor test stays enabled
+        /// and the scissor box is set back to the given area.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(sf::RenderTarget& target, const sf::IntRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Calls begin, unless another clip stack is already active for the target.
+        ///
+        /// \param target  Render target on which the widget will be drawn
+        ///
+        /// Widgets that clip their contents call this before pushing their area, so that they are also clipped when they are
+        /// drawn without gui. Call end afterwards, it does nothing when begin wasn't called.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginIfInactive(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Restores the scissor state from before begin and makes the previously active clip stack active again.
+        ///
+        /// Nothing happens when this clip stack isn't active.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Checks whether a clip stack is active for the given target.
+        ///
+        /// \param target  Render target that is being drawn on
+        ///
+        /// \return True when begin was called on a clip stack for this target and end wasn't called yet
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isActive(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many times the scissor box was changed since begin was called.
+        ///
+        /// \return Amount of glScissor calls
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getScissorChangeCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many widgets were drawn since begin was called.
+        ///
+        /// \return Amount of widgets that passed isWidgetVisible
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawnWidgetCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many widgets were skipped since begin was called, because they were outside the visible area.
+        ///
+        /// \return Amount of widgets for which isWidgetVisible returned false
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCulledWidgetCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Limits drawing on the target to the given area, until pop is called.
+        ///
+        /// \param target  Render target that is being drawn on
+        /// \param area    Area in the coordinates of the current view of the target, e.g. the absolute position and size of
+        ///                a widget
+        ///
+        /// Nothing happens when there is no active clip stack for the target.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void push(sf::RenderTarget& target, const sf::FloatRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Restores the area that was used before the last call to push.
+        ///
+        /// \param target  Render target that is being drawn on
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void pop(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Checks if a widget has to be drawn, and counts it as either drawn or culled.
+        ///
+        /// \param target  Render target that is being drawn on
+        /// \param bounds  Area in which the widget draws, in the same coordinates as the area passed to push.
+        ///                Pass nullptr when the widget can't tell where it draws, it is then always drawn.
+        ///
+        /// \return False when the widget lies completely outside the current area, true otherwise.
+        ///         True is always returned when there is no active clip stack for the target.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isWidgetVisible(sf::RenderTarget& target, const sf::FloatRect* bounds);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Makes this the active stack with the given area at the bottom
+        void start(sf::RenderTarget& target, const sf::IntRect& area, bool enableScissorTest);
+
+        // Changes the scissor box to the area on top of the stack, unless it is already the current one
+        void apply();
+
+        // Passes the area to OpenGL or to the recording target
+        void setScissor(const sf::IntRect& area);
+
+        // Converts an area in the coordinates of the view to pixels, with the origin in the top left corner of the target
+        static sf::FloatRect toPixels(const sf::RenderTarget& target, const sf::FloatRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        sf::RenderTarget* m_Target;
+        RecordingTarget*  m_Recorder;   // Receives the clipping area instead of OpenGL when drawing on a recording target
+        ClipStack*        m_PreviousStack;
+
+        // The visible areas in pixels, with the origin in the top left corner of the target
+        std::vector<sf::IntRect> m_Areas;
+
+        // The area that was last passed to glScissor
+        sf::IntRect m_AppliedArea;
+
+        // Was the scissor test enabled by begin? Otherwise it has to stay enabled when end is called.
+        bool m_EnabledScissorTest;
+
+        unsigned int m_ScissorChanges;
+        unsigned int m_DrawnWidgets;
+        unsigned int m_CulledWidgets;
+
+        static ClipStack* m_ActiveStack;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_CLIP_STACK_HPP
@@ -35,14 +35,58 @@
 
 namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // A value from a config file. The value is parsed once when the file is read, so that loading widgets from the same
+    // config file again doesn't have to parse any strings.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API ConfigValue
+    {
+        ConfigValue();
+
+        // The value as it was written in the config file
+        std::string string;
+
+        // The value interpreted as the different types (the flags tell whether the value was really of that type)
+        bool        isBool;
+        bool        boolValue;
+        sf::Color   color;
+        bool        isBorders;
+        Borders     borders;
+        bool        isTexture;
+        std::string filename;
+        sf::IntRect textureRect;
+
+        // The image that the texture was loaded from the last time, which doesn't keep the image loaded
+        mutable CachedImage cachedImage;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // The properties (in lowercase) and their values of a section in a config file.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API ConfigSection
+    {
+        std::vector<std::string> properties;
+        std::vector<ConfigValue> values;
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \internal
     // Reads the config files that are used to load widgets.
+    // Multiple threads can read config files at the same time, the cache is protected by a mutex. The sections that are
+    // returned by the read function are never changed afterwards, so they can be used without locking.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API ConfigFile : public sf::NonCopyable
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ConfigFile();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Destructor. Closes the file if still open.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,11 +106,12 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Reads a specific section from the file and returns the corresponding properties and values.
+        // The file is only parsed the first time, after that the cached section is returned without copying it.
         //
-        // return:  true when a section was found
-        //          false when there was no section with the given name
+        // return:  the section, which remains valid until flushCache is called
+        //          nullptr when there was no section with the given name
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool read(const std::string& section, std::vector<std::string>& properties, std::vector<std::string>& values);
+        const ConfigSection* read(const std::string& section);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,9 +121,21 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Reads a color from a string value.
+        // Reads a bool from a value.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        sf::Color readColor(const std::string& value) const;
+        bool readBool(const ConfigValue& value, bool defaultValue) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads a color from a value.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& readColor(const ConfigValue& value) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads borders from a value.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool readBorders(const ConfigValue& value, Borders& borders) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,9 +145,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Loads a texture based on the contents of the string value.
+        // Loads a texture based on the contents of the value.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool readTexture(const std::string& value, const std::string& rootPath, Texture& texture) const;
+        bool readTexture(const ConfigValue& value, const std::string& rootPath, Texture& texture) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,6 +171,31 @@ namespace tgui
         bool readAndCache();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Interprets the string of the value as all the different types.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseValue(ConfigValue& value) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the filenames of all images that are used in the file (the file has to be cached).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::string> readImageFilenames() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the texture manager which parts of the images will be repeated. These are the middle images, whose property
+        // ends with _M, so that the texture of the repeated part is made while the pixels are still in memory.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addRepeatedParts(const std::string& filename, const std::map<std::string, ConfigSection>& sections);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads the filename between quotes, starting from the quote at character c.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool readFilename(const std::string& value, std::string::const_iterator& c, std::string& filename) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Remove the whitespace from the line, starting from the character c.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,7 +221,16 @@ namespace tgui
 
         std::string m_Filename;
 
-        static std::map<std::string, std::map<std::string, std::pair<std::vector<std::string>, std::vector<std::string>>>> m_Cache;
+        // The sections of the opened file inside the cache (nullptr when the file wasn't parsed yet)
+        std::map<std::string, ConfigSection>* m_CachedFile;
+
+        static std::map<std::string, std::map<std::string, ConfigSection>> m_Cache;
+
+        // Protects the cache
+        static sf::Mutex m_CacheMutex;
+
+        // Theme bundles fill the cache directly, without parsing any text
+        friend class ThemeBundle;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
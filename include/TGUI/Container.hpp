@@ -28,6 +28,7 @@
 
 
 #include <list>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
 
@@ -37,6 +38,15 @@ namespace tgui
 {
     struct Callback;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Hash function for widget names, so that they can be used as key in an unordered map.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API NameHash
+    {
+        std::size_t operator()(const sf::String& name) const;
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Parent class for widgets that store multiple widgets.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,7 +129,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns a list of all the widgets.
         ///
-        /// \return Vector of all widget pointers
+        /// \return Vector of all widget pointers, from the widget in the back to the one in front
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::vector<Widget::Ptr>& getWidgets();
@@ -128,10 +138,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns a list of the names of all the widgets.
         ///
-        /// \return Vector of all widget names
+        /// \return Vector of all widget names, in the same order as getWidgets
+        ///
+        /// Use setWidgetName to change the name of a widget, so that the widget can still be found by its new name.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::vector<sf::String>& getWidgetNames();
+        const std::vector<sf::String>& getWidgetNames() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -196,6 +208,68 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a pointer to a widget inside nested containers.
+        ///
+        /// \param path  The names of the containers and of the widget, separated by dots.
+        ///
+        /// \return Pointer to the widget, or nullptr when one of the names in the path wasn't found.
+        ///
+        /// Every name in the path is looked up directly in the container that was found by the previous name, so unlike
+        /// calling get with the recursive parameter, the rest of the widgets are never searched.
+        ///
+        /// Usage example:
+        /// \code
+        /// tgui::Slider::Ptr volume = container.getByPath<tgui::Slider>("Settings.Audio.Volume");
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getByPath(const sf::String& path) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a pointer to a widget inside nested containers.
+        ///
+        /// \param path  The names of the containers and of the widget, separated by dots.
+        ///
+        /// \return Pointer to the widget, or nullptr when one of the names in the path wasn't found.
+        ///         The pointer will already be casted to the desired type.
+        ///
+        /// \see getByPath
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getByPath(const sf::String& path) const
+        {
+            return typename T::Ptr(getByPath(path));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether the container keeps an index of the names of all widgets inside it, including the widgets
+        ///        inside its child containers.
+        ///
+        /// \param enabled  Should the index be kept?
+        ///
+        /// With the index, calling get with the recursive parameter no longer has to search through the child containers.
+        /// The index is only rebuilt on the first search after a widget somewhere inside the container was added, removed
+        /// or renamed, so it is only useful when searching happens more often than changing the widgets.
+        ///
+        /// The index is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTreeNameIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the container keeps an index of the names of all widgets inside it.
+        ///
+        /// \see setTreeNameIndexEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTreeNameIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Makes a copy of any existing widget and returns the pointer to the new widget.
         ///
@@ -220,6 +294,9 @@ namespace tgui
         ///
         /// \param widget  Pointer to the widget to remove
         ///
+        /// The other widgets are not moved, so removing a widget takes the same time no matter how many widgets the
+        /// container holds.
+        ///
         /// Usage example:
         /// \code
         /// tgui::Picture::Ptr pic(container, "picName");
@@ -241,6 +318,17 @@ namespace tgui
         virtual void remove(Widget* widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes multiple widgets that were added to the container.
+        ///
+        /// \param widgets  Pointers to the widgets to remove
+        ///
+        /// Widgets in the list that are not part of this container are ignored. The list may be the one returned by getWidgets.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void remove(const std::vector<Widget::Ptr>& widgets);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Removes all widgets that were added to the container.
         ///
@@ -248,6 +336,67 @@ namespace tgui
         virtual void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Allocates the widgets that are created inside this container from a pool instead of the heap.
+        ///
+        /// \param enabled  Should widgets created inside this container (and the containers inside it) come from an arena?
+        ///
+        /// Only widgets that are created with the constructor of SharedWidgetPtr that takes the container (or one of its
+        /// child containers) use the arena, other widgets that are added keep their heap memory. The memory is released in
+        /// bulk once all widgets from the arena are destroyed, e.g. after calling removeAllWidgets.
+        /// Disabling the arena doesn't affect the widgets that were already created, they keep it alive until they are gone.
+        ///
+        /// Note that only the widgets themselves come from the arena, the memory that they allocate internally (e.g. for
+        /// their text) still comes from the heap.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetArenaEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Check if this container has its own widget arena.
+        ///
+        /// \return Was setWidgetArenaEnabled(true) called on this container?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isWidgetArenaEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the widget arena from which new widgets inside this container are allocated.
+        ///
+        /// \return The arena of this container or of the closest parent that has one, or nullptr when there is none
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetArena* getWidgetArena() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Keeps the contents of the container in a texture, so that they don't have to be drawn again every frame.
+        ///
+        /// \param enabled  Should the contents be cached?
+        ///
+        /// The widgets inside the container are drawn to an offscreen texture, which is then drawn every frame as a single
+        /// image. The texture is only drawn again after a widget inside the container changed, e.g. when a property was set,
+        /// the mouse moved over a widget or an animation advanced. This is useful for panels that contain many widgets which
+        /// rarely change, but it costs an extra texture of the size of the container.
+        ///
+        /// Only panels and child windows keep a cache, for other containers this setting has no effect.
+        /// The cache is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Check if the contents of the container are cached in a texture.
+        ///
+        /// \return Was setRenderCacheEnabled(true) called on this container?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCacheEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the name of a widget.
         ///
@@ -334,6 +483,8 @@ namespace tgui
         ///
         /// \param widget  The widget that should be moved to the front
         ///
+        /// Only the widget itself gets a new place in the drawing order, this takes constant time.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void moveWidgetToFront(Widget *const widget);
 
@@ -343,6 +494,8 @@ namespace tgui
         ///
         /// \param widget  The widget that should be moved to the back
         ///
+        /// Just like moveWidgetToFront, this takes constant time.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void moveWidgetToBack(Widget *const widget);
 
@@ -511,6 +664,12 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the shortest time after which one of the visible widgets inside this container will change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getTimeUntilUpdate(sf::Time& time) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When this function is called then all the widgets receive the event (if there are widgets).
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -525,6 +684,13 @@ namespace tgui
         bool focusNextWidgetInContainer();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Focuses the previous widget in the container. If the first widget was focused then all widgets will be unfocused and
+        // this function will return false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool focusPreviousWidgetInContainer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When the tab key is pressed then this function is called. The focus will move to the next widget (if there is one).
         // This function will only work when tabKeyUsageEnabled is true.
@@ -533,6 +699,14 @@ namespace tgui
         bool tabKeyPressed();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // When shift and the tab key are pressed then this function is called. The focus will move to the previous widget.
+        // This function will only work when tabKeyUsageEnabled is true.
+        // The function will return true when another widget was focused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool shiftTabKeyPressed();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Checks above which widget the mouse is standing.
         // If there is no widget below the mouse then this function will return a null pointer.
@@ -540,6 +714,163 @@ namespace tgui
         Widget::Ptr mouseOnWhichWidget(float x, float y);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget at the given position in the list of widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeWidgetAt(unsigned int index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the widgets that can be focused with the tab key, in the order in which they are focused.
+        // The chain is only rebuilt when widgets were added, removed, reordered, shown, hidden, enabled or disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Widget*>& getFocusChain() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position in the focus chain of the widget that comes after the focused one (which can be the end of the
+        // chain), or of the first widget when nothing is focused. Only valid right after calling getFocusChain.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getNextInFocusChain() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position in the focus chain of the widget that comes before the focused one plus one (which can be 0),
+        // or the size of the chain when nothing is focused. Only valid right after calling getFocusChain.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getPreviousInFocusChain() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Unfocuses the focused widget and focuses the given one instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFocusedWidget(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks everything that depends on the list of widgets as outdated, after widgets were added, removed or reordered.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetListChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the grid that is used by mouseOnWhichWidget to only check the widgets near the mouse.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildMouseGrid();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks all widgets again where they draw, so that drawWidgetContainer can skip the ones outside the visible area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDrawBounds() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers which widget is below the mouse and tells the previous one that the mouse is no longer on top of it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHoveredWidget(const Widget::Ptr& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells a widget that the mouse went up somewhere else and marks the container as changed when that matters.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseNoLongerDownOnWidget(Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the render cache of this container and of all its parents as outdated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void appearanceChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the mouse grid and the draw bounds as outdated after one of the widgets was moved or resized.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childBoundsChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the focus chain as outdated after one of the widgets was shown, hidden, enabled, disabled or got another
+        // tab index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childFocusableChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the outdated render caches of this container and of the containers inside it again, the inner ones first.
+        // Returns true when something was drawn, because the render target of the gui has to be activated again afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateRenderCaches();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Prepares the render cache for drawing the area with the given absolute position and size on it.
+        // The view of the texture is placed on top of that area, so widgets can be drawn on it just like on the window.
+        // Returns nullptr when the texture could not be created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::RenderTexture* beginRenderCache(const sf::Vector2f& position, const sf::Vector2f& size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finishes drawing on the render cache and marks it as up to date.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endRenderCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sorts the widgets from back to front again, when widgets were removed or reordered since the last time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetList() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the slot that holds the widget, or the amount of slots when the widget is not inside this container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findWidgetSlot(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the widget in a free slot and places it in front of the other widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidgetSlot(const Widget::Ptr& widget, const sf::String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget in the given slot from the container and frees the slot.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeWidgetSlot(unsigned int slot);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Counts the widget in the index of its name, after it was added or renamed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToNameIndex(const sf::String& name, const Widget::Ptr& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget from the index of its name, after it was removed or renamed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromNameIndex(const sf::String& name, const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the first widget with the given name, or nullptr when no widget inside this container has that name.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getFirstWidgetWithName(const sf::String& name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells this container and the containers around it that a widget inside them was added, removed or renamed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateTreeNameIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets inside this container to the index, unless a widget with the same name was added before.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToTreeNameIndex(std::unordered_map<sf::String, const Container*, NameHash>& index) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -549,17 +880,109 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
-        std::vector<Widget::Ptr> m_Widgets;
-        std::vector<sf::String>  m_ObjName;
+        // A widget keeps the same slot while it is inside this container, so that removing or reordering it doesn't move the
+        // other widgets. The widget remembers its slot in m_ContainerSlot. Free slots are reused by the next widget that is
+        // added. The order of the widgets is given by their z-order key, a widget with a higher key lies in front.
+        struct WidgetSlot
+        {
+            WidgetSlot() : widget(nullptr), zOrder(0), listIndex(0) {}
+
+            Widget::Ptr widget;
+            sf::String  name;
+            sf::Int64   zOrder;
+
+            // Where the widget was placed in m_Widgets when that list was last built
+            mutable unsigned int listIndex;
+        };
+
+        std::vector<WidgetSlot>   m_WidgetSlots;
+        std::vector<unsigned int> m_FreeWidgetSlots;
+        sf::Int64                 m_FrontZOrder;
+        sf::Int64                 m_BackZOrder;
+
+        // The widgets and their names sorted from back to front. The lists are only sorted again by updateWidgetList when
+        // they are needed after widgets were removed or reordered. A removed widget is replaced by nullptr in m_Widgets right
+        // away so that the list doesn't keep it alive. Loops that can trigger callbacks have to skip these entries, because
+        // a callback may remove widgets while the loop is still running.
+        mutable bool                     m_WidgetListValid;
+        mutable std::vector<Widget::Ptr> m_Widgets;
+        mutable std::vector<sf::String>  m_ObjName;
+
+        // The first widget with each name and the amount of widgets with that name, so that widgets can be found without
+        // comparing all the names. A name is only stored here while a widget in this container uses it. When the first
+        // widget is removed or moved while other widgets have the same name, the new first widget is only searched when
+        // it is needed.
+        struct NameIndexEntry
+        {
+            NameIndexEntry(const Widget::Ptr& firstWidget) : widget(firstWidget), count(1) {}
+
+            Widget::Ptr  widget;
+            unsigned int count;
+        };
 
-        // The id of the focused widget
-        unsigned int m_FocusedWidget;
+        mutable std::unordered_map<sf::String, NameIndexEntry, NameHash> m_NameIndex;
+
+        // The focused widget, or nullptr when no widget is focused.
+        // It is not stored as a position, so that it stays valid when other widgets are removed or moved.
+        Widget* m_FocusedWidget;
 
         sf::Font m_GlobalFont;
 
         // A list that stores all functions that receive callbacks triggered by child widgets
         std::list< std::function<void(const Callback&)> > m_GlobalCallbackFunctions;
 
+        // For each name, the container (this one or one inside it) that holds the first widget with that name.
+        // The index becomes invalid when a widget inside this container or one of its child containers is added, removed
+        // or renamed. It stores no widget pointers, so it never keeps removed widgets alive.
+        bool m_TreeNameIndexEnabled;
+        mutable bool m_TreeNameIndexValid;
+        mutable std::unordered_map<sf::String, const Container*, NameHash> m_TreeNameIndex;
+
+        // Uniform grid over the bounds of the widgets, so that a mouse event only has to check the widgets near the mouse.
+        // Every cell stores the indices of the widgets that overlap it, in the same order as in m_Widgets. Widgets that
+        // don't know their bounds are always checked. The grid is outdated when one of these widgets is moved or resized and
+        // when widgets are added, removed or reordered.
+        bool                                     m_MouseGridValid;
+        sf::FloatRect                            m_MouseGridArea;
+        unsigned int                             m_MouseGridColumns;
+        unsigned int                             m_MouseGridRows;
+        std::vector< std::vector<unsigned int> > m_MouseGridCells;
+        std::vector<unsigned int>                m_UnboundedWidgets;
+
+        // The draw bounds of the widgets, in the same order as m_Widgets. They are only valid when m_HasDrawBounds is true
+        // for the same widget. The bounds are outdated under the same conditions as the mouse grid.
+        mutable bool                       m_DrawBoundsValid;
+        mutable std::vector<sf::FloatRect> m_DrawBounds;
+        mutable std::vector<bool>          m_HasDrawBounds;
+
+        // The widget below the mouse during the last mouse event, it is the only one that can have m_MouseHover set
+        Widget::Ptr m_HoveredWidget;
+
+        // Where a widget is placed in the focus chain, or where it would be placed when it can't be focused
+        struct FocusChainPosition
+        {
+            FocusChainPosition() : index(0), inChain(false) {}
+            FocusChainPosition(unsigned int chainIndex, bool isInChain) : index(chainIndex), inChain(isInChain) {}
+
+            unsigned int index;
+            bool         inChain;
+        };
+
+        // The widgets that can be focused with the tab key, in tab order. The chain is outdated when one of these widgets
+        // changes whether it can be focused and when widgets are added, removed or reordered.
+        mutable bool                                                  m_FocusChainValid;
+        mutable std::vector<Widget*>                                  m_FocusChain;
+        mutable std::unordered_map<const Widget*, FocusChainPosition> m_FocusChainPositions;
+
+        // Pool from which widgets created inside this container are allocated, or nullptr to use the heap
+        WidgetArena* m_WidgetArena;
+
+        // Texture with the contents of the container, which is only drawn again when it is no longer valid.
+        // The texture is created the first time that it is needed.
+        bool               m_RenderCacheEnabled;
+        bool               m_RenderCacheValid;
+        sf::RenderTexture* m_RenderCache;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -575,6 +998,13 @@ namespace tgui
         typedef SharedWidgetPtr<Container> Ptr;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GuiContainer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Unbind the global callback function(s).
         ///
@@ -627,11 +1057,23 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that the gui has to be drawn again, because one of the widgets changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void appearanceChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         sf::RenderTarget* m_Window;
 
+        // Did anything change since the gui was last drawn?
+        bool m_RedrawNeeded;
+
 
         friend class Gui;
 
@@ -519,6 +519,12 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the selection point blinks, while the edit box is focused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getTimeUntilUpdate(sf::Time& time) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -540,6 +546,18 @@ namespace tgui
         };
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Emitted when the text changed, with the new text as parameter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal<const sf::String&> onTextChanged;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Emitted when the return key was pressed, with the text as parameter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal<const sf::String&> onReturnKeyPressed;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -164,6 +164,15 @@ namespace tgui
         virtual void remove(Widget* widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes multiple widgets that were added to the container.
+        ///
+        /// \param widgets  Pointers to the widgets to remove
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void remove(const std::vector<Widget::Ptr>& widgets);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Removes all widgets that were added to the container.
         ///
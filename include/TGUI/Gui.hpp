@@ -27,7 +27,9 @@
 #define TGUI_WINDOW_HPP
 
 
-#include <queue>
+#include <vector>
+#include <atomic>
+#include <functional>
 
 #include <TGUI/Container.hpp>
 
@@ -131,6 +133,286 @@ namespace tgui
         void draw(bool resetView = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Checks if the gui would look different when it is drawn now.
+        ///
+        /// \return True when something changed since the last call to draw, or when an animation has to make a step
+        ///
+        /// Property changes, hover and focus changes, events, commands from other threads, blinking selection points and
+        /// animated pictures all make this function return true. When the window contains nothing but the gui, it only
+        /// has to be redrawn when this function returns true.
+        ///
+        /// \code
+        /// while (window.isOpen())
+        /// {
+        ///     sf::Event event;
+        ///     while (window.pollEvent(event))
+        ///         gui.handleEvent(event);
+        ///
+        ///     if (gui.needsRedraw())
+        ///     {
+        ///         window.clear();
+        ///         gui.draw();
+        ///         window.display();
+        ///     }
+        ///     else // Sleep until the next animation step, but wake up regularly to handle events
+        ///         sf::sleep(std::min(gui.timeUntilNextUpdate(), sf::milliseconds(20)));
+        /// }
+        /// \endcode
+        ///
+        /// \see timeUntilNextUpdate
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how long it takes until the gui has to be drawn again, when nothing else changes in the meantime.
+        ///
+        /// \return Time until the next blink of a selection point or the next frame of an animated picture.
+        ///         Zero is returned when the gui has to be drawn right away.
+        ///         When nothing is animating, the longest time that sf::Time can hold is returned.
+        ///
+        /// Animations only advance while the gui is focused, so nothing is scheduled while the gui is unfocused.
+        ///
+        /// \see needsRedraw
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time timeUntilNextUpdate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Commands that were posted but not yet processed are destroyed without being executed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~Gui();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Queues a function that has to be executed on the thread that draws the gui.
+        ///
+        /// \param command  Function that will be called during the next call to processCommands
+        ///
+        /// This is the only gui function that may be called from any thread. The queue doesn't use a lock, posting a command
+        /// only allocates a node and swaps a pointer. The commands are executed in the order in which they were posted
+        /// by the same thread, at the start of the draw function.
+        ///
+        /// Widgets may not be touched on the other thread. Unless TGUI was built with TGUI_USE_ATOMIC_REFCOUNT, don't copy
+        /// a Widget::Ptr there either. Capture a raw pointer or the name of the widget instead and look it up inside the command.
+        ///
+        /// Usage example:
+        /// \code
+        /// tgui::ChatBox* chatBox = chatBoxPtr.get();
+        /// std::thread network([&gui, chatBox]{ gui.postCommand([chatBox]{ chatBox->addLine("Connected"); }); });
+        /// \endcode
+        ///
+        /// \see setCommandBudget
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postCommand(const std::function<void()>& command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Executes the commands that were posted with postCommand.
+        ///
+        /// \return Amount of commands that were executed
+        ///
+        /// This function is called by the draw function, but you can call it yourself when you need the commands to be
+        /// executed earlier, e.g. before handling the events. At most as many commands as the command budget are executed
+        /// per call, the rest remains in the queue for the next call.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int processCommands();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Limits the amount of commands that are executed per call to processCommands (and thus per frame).
+        ///
+        /// \param maxCommands  Maximum amount of commands per call, or 0 to execute all queued commands (default)
+        ///
+        /// This prevents a burst of commands (e.g. thousands of log lines) from stalling a frame.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCommandBudget(unsigned int maxCommands);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the maximum amount of commands that are executed per call to processCommands.
+        ///
+        /// \return The command budget, or 0 when there is no limit
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCommandBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of commands that are waiting to be executed.
+        ///
+        /// \return Amount of posted commands that haven't been processed yet
+        ///
+        /// Commands may be posted while this function is executing, so the value is only a snapshot.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getPendingCommandCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Merges mouse move events that arrive faster than the gui is drawn.
+        ///
+        /// \param enabled           When true, handleEvent holds mouse move events back and only passes the last position to
+        ///                          the widgets. This happens right before the next event that isn't a mouse move, when draw
+        ///                          is called or when handlePendingMouseMove is called. The order of the events is never changed.
+        /// \param maxPendingEvents  When not 0, the mouse position is also passed to the widgets after this many mouse moves.
+        ///
+        /// This is disabled by default. Disabling it passes the pending mouse move to the widgets immediately.
+        ///
+        /// While a mouse move is held back, handleEvent returns false for it because it is not known yet whether it will be used.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseMoveCoalescing(bool enabled, unsigned int maxPendingEvents = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether mouse move events are being merged.
+        ///
+        /// \return Is mouse move coalescing enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMouseMoveCoalescingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Passes the mouse move that is being held back to the widgets.
+        ///
+        /// \return Has the mouse move been consumed?
+        ///         False is also returned when there was no mouse move being held back.
+        ///
+        /// You only need to call this function when you need the widgets to be up to date without drawing the gui.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool handlePendingMouseMove();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many mouse move events were dropped because a newer mouse move replaced them.
+        ///
+        /// \return Number of merged mouse move events since the gui was created or since the counter was reset
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCoalescedMouseMoveCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Sets the counter that is returned by getCoalescedMouseMoveCount back to 0.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetCoalescedMouseMoveCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether the sprites, rectangles and texts of different widgets are combined into fewer draw calls.
+        ///
+        /// \param enabled  Should the widgets be drawn in batches?
+        ///
+        /// Batching is enabled by default. You can disable it to compare the result of getDrawCallCount with and without it.
+        ///
+        /// \see RenderBatch
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the widgets are drawn in batches.
+        ///
+        /// \return Is batching enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many draw calls the last call to draw made on the render target.
+        ///
+        /// \return Amount of draw calls that the widgets needed during the last frame
+        ///
+        /// Widgets inside a panel or child window with a render cache only count while the cache is drawn on the target,
+        /// not while the cache itself is being redrawn.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many times the clipping area on the render target changed during the last call to draw.
+        ///
+        /// \return Amount of times that the scissor box was changed during the last frame
+        ///
+        /// Widgets that clip their contents only cause a change when their area differs from the one that is already set.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getClipChangeCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Limits drawing the gui to the given area of the window.
+        ///
+        /// \param area  Area in pixels, with the origin in the top left corner of the window
+        ///
+        /// Use this when you enabled the scissor test yourself, the gui doesn't ask OpenGL for the scissor box. The widgets are
+        /// only drawn inside this area, and afterwards the scissor test stays enabled with the scissor box set to this area.
+        ///
+        /// By default the gui draws on the whole window, and disables the scissor test again when it is done drawing.
+        ///
+        /// \see resetClipArea
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setClipArea(const sf::IntRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Lets the gui draw on the whole window again.
+        ///
+        /// \see setClipArea
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetClipArea();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the area of the window in which the gui is drawn.
+        ///
+        /// \return The area passed to setClipArea, or the whole window when no area was set
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::IntRect getClipArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many widgets were drawn during the last call to draw.
+        ///
+        /// \return Amount of visible widgets that were inside the visible area of their parent
+        ///
+        /// \see getCulledWidgetCount
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawnWidgetCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many widgets were skipped during the last call to draw, because nothing of them would be visible.
+        ///
+        /// \return Amount of visible widgets that were completely outside the visible area of their parent
+        ///
+        /// Widgets that are scrolled out of a panel or that lie outside the window are not drawn at all. Their children are
+        /// not counted, as they are never looked at.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCulledWidgetCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Get the next callback from the callback queue.
         ///
@@ -152,6 +434,72 @@ namespace tgui
         bool pollCallback(Callback& callback);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Get multiple callbacks from the callback queue at once.
+        ///
+        /// \param callbacks     Array in which the callbacks will be stored
+        /// \param maxCallbacks  Amount of callbacks that fit inside the array
+        ///
+        /// \return Amount of callbacks that were stored in the array, which is 0 when the queue is empty.
+        ///
+        /// The callbacks are removed from the queue in the same order as pollCallback would return them.
+        /// Reusing the same array every frame avoids memory allocations, as the text in the callbacks can reuse its memory.
+        ///
+        /// Usage example:
+        /// \code
+        /// tgui::Callback callbacks[64];
+        /// unsigned int count;
+        /// while ((count = gui.pollCallbacks(callbacks, 64)) > 0)
+        /// {
+        ///     for (unsigned int i = 0; i < count; ++i)
+        ///         handleCallback(callbacks[i]);
+        /// }
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int pollCallbacks(Callback* callbacks, unsigned int maxCallbacks);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the amount of callbacks that fit inside the callback queue without it having to grow.
+        ///
+        /// \param capacity  Amount of callbacks for which memory is reserved
+        ///
+        /// The queue grows automatically when it is full, so no callbacks are ever lost. Choosing a capacity that is larger
+        /// than the callback queue high watermark avoids this. The capacity never becomes smaller than the amount of
+        /// callbacks that are currently in the queue.
+        ///
+        /// \see getCallbackQueueHighWatermark
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCallbackQueueCapacity(unsigned int capacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of callbacks that fit inside the callback queue without it having to grow.
+        ///
+        /// \return Capacity of the callback queue
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCallbackQueueCapacity() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the largest amount of callbacks that were ever waiting in the callback queue at the same time.
+        ///
+        /// \return Highest amount of queued callbacks since the gui was created or since the high watermark was reset
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCallbackQueueHighWatermark() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Sets the value that is returned by getCallbackQueueHighWatermark to the amount of callbacks in the queue.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetCallbackQueueHighWatermark();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Check if the window is focused.
         ///
@@ -237,8 +585,10 @@ namespace tgui
         ///
         /// \return Vector of all widget names
         ///
+        /// Use setWidgetName to change the name of a widget, so that the widget can still be found by its new name.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::vector<sf::String>& getWidgetNames();
+        const std::vector<sf::String>& getWidgetNames() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,6 +653,58 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a pointer to a widget inside nested containers.
+        ///
+        /// \param path  The names of the containers and of the widget, separated by dots.
+        ///
+        /// \return Pointer to the widget, or nullptr when one of the names in the path wasn't found.
+        ///
+        /// Every name in the path is looked up directly in the container that was found by the previous name, so unlike
+        /// calling get with the recursive parameter, the rest of the widgets are never searched.
+        ///
+        /// Usage example:
+        /// \code
+        /// tgui::Slider::Ptr volume = gui.getByPath<tgui::Slider>("Settings.Audio.Volume");
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getByPath(const sf::String& path) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns a pointer to a widget inside nested containers.
+        ///
+        /// \param path  The names of the containers and of the widget, separated by dots.
+        ///
+        /// \return Pointer to the widget, or nullptr when one of the names in the path wasn't found.
+        ///         The pointer will already be casted to the desired type.
+        ///
+        /// \see getByPath
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getByPath(const sf::String& path) const
+        {
+            return m_Container.getByPath<T>(path);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether the gui keeps an index of the names of all widgets, including the widgets inside containers.
+        ///
+        /// \param enabled  Should the index be kept?
+        ///
+        /// With the index, calling get with the recursive parameter no longer has to search through the containers.
+        /// The index is only rebuilt on the first search after a widget was added, removed or renamed, so it is only useful
+        /// when searching happens more often than changing the widgets.
+        ///
+        /// The index is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTreeNameIndexEnabled(bool enabled);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Makes a copy of any existing widget and returns the pointer to the new widget.
         ///
@@ -339,6 +741,17 @@ namespace tgui
         void remove(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Removes multiple widgets that were added to the gui.
+        ///
+        /// \param widgets  Pointers to the widgets to remove
+        ///
+        /// This is faster than removing the widgets one by one, as the remaining widgets are only moved once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void remove(const std::vector<Widget::Ptr>& widgets);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Removes all widgets that were added to the container.
         ///
@@ -346,6 +759,28 @@ namespace tgui
         void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Allocates the widgets that are created inside the gui from a pool instead of the heap.
+        ///
+        /// \param enabled  Should widgets created inside the gui (and the containers inside it) come from an arena?
+        ///
+        /// The memory is released in bulk once all widgets from the arena are destroyed, e.g. after removeAllWidgets.
+        ///
+        /// \see Container::setWidgetArenaEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetArenaEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Check if the gui allocates its widgets from a widget arena.
+        ///
+        /// \return Was setWidgetArenaEnabled(true) called?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isWidgetArenaEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Changes the name of a widget.
         ///
@@ -523,8 +958,45 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
-        // This will store all widget callbacks until you pop them with getCallback
-        std::queue<Callback> m_Callback;
+        // Node of the command queue, which is an intrusive multi-producer single-consumer queue (Dmitry Vyukov's algorithm).
+        // Producers only exchange the head, the gui thread is the only one that reads and changes the tail.
+        struct CommandNode
+        {
+            CommandNode() : next(nullptr) {}
+
+            std::atomic<CommandNode*> next;
+            std::function<void()>     command;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts the mouse position of the event to the view and passes the event to the widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool dispatchEvent(sf::Event event, bool resetView);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a node to the command queue. This function can be called from any thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushCommand(CommandNode* node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the oldest node from the command queue. Returns nullptr when the queue is empty or when the oldest node
+        // is still being added by another thread. This function may only be called from the gui thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandNode* popCommand();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        // Ring buffer that stores all widget callbacks until you pop them with pollCallback.
+        // The slots are reused, so that the text inside the callbacks doesn't have to allocate memory every time.
+        std::vector<Callback> m_CallbackQueue;
+        unsigned int          m_CallbackQueueStart;
+        unsigned int          m_CallbackQueueSize;
+        unsigned int          m_CallbackQueueHighWatermark;
 
         // The internal clock which is used for animation of widgets
         sf::Clock m_Clock;
@@ -538,6 +1010,33 @@ namespace tgui
         // Internal container to store all widgets
         GuiContainer m_Container;
 
+        // The last mouse move that is being held back, with the resetView parameter that was passed with it
+        bool         m_MouseMoveCoalescing;
+        unsigned int m_MaxPendingMouseMoves;
+        unsigned int m_PendingMouseMoves;
+        sf::Event    m_PendingMouseMove;
+        bool         m_PendingMouseMoveResetView;
+
+        // The amount of mouse moves that were replaced by a newer one
+        unsigned int m_CoalescedMouseMoves;
+
+        // Queue with commands posted by other threads, and the maximum amount of commands to execute per frame
+        std::atomic<CommandNode*> m_CommandQueueHead;
+        CommandNode*              m_CommandQueueTail;
+        CommandNode               m_CommandQueueStub;
+        std::atomic<unsigned int> m_PendingCommands;
+        unsigned int              m_CommandBudget;
+
+        // Combines what the widgets draw into as few draw calls as possible
+        RenderBatch m_RenderBatch;
+
+        // Keeps track of the clipping area of the widgets, so that the scissor state never has to be queried
+        ClipStack m_ClipStack;
+
+        // The area that the application clips the gui to, only used when m_ClipAreaSet is true
+        bool        m_ClipAreaSet;
+        sf::IntRect m_ClipArea;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -669,6 +669,12 @@ namespace tgui
         };
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Emitted when a new item was selected, with the item and its index as parameters (an empty string and -1 when nothing is selected).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal<const sf::String&, int> onItemSelected;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -406,6 +406,12 @@ namespace tgui
         };
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Emitted when a menu item was clicked, with the menu item and the index of its menu as parameters.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal<const sf::String&, unsigned int> onMenuItemClicked;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -0,0 +1,226 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RECORDING_TARGET_HPP
+#define TGUI_RECORDING_TARGET_HPP
+
+
+#include <vector>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Render target that doesn't draw anything, but remembers what was drawn on it.
+    ///
+    /// The gui can draw on this target just like on a window, without a single OpenGL call being made while drawing.
+    /// Every draw call that the widgets would make is stored instead, together with the amount of vertices, the texture,
+    /// the transformation and the clipping area that would have been used. This gives exact numbers about the cost of
+    /// drawing the widgets, also on machines without graphics card.
+    ///
+    /// Only what is drawn through the gui is recorded. Loading the textures and fonts of the widgets still happens in
+    /// the usual way, so a (software) OpenGL context is still needed for that.
+    ///
+    /// \code
+    /// tgui::RecordingTarget target(800, 600);
+    /// tgui::Gui gui(target);
+    /// ...
+    /// gui.draw();
+    /// std::cout << target.getDrawCallCount() << " draw calls, " << target.getVertexCount() << " vertices" << std::endl;
+    /// \endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RecordingTarget : public sf::RenderTarget
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief A single draw call that was recorded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct DrawCommand
+        {
+            // Type of the primitives that would have been drawn
+            sf::PrimitiveType primitiveType;
+
+            // Amount of vertices that would have been sent to the graphics card
+            unsigned int vertexCount;
+
+            // Texture that would have been bound, or nullptr when nothing is textured
+            const sf::Texture* texture;
+
+            // Transformation of the vertices. Combined draw calls of the gui have their vertices already transformed.
+            sf::Transform transform;
+
+            // Area outside of which nothing would be visible, in pixels with the origin in the top left corner
+            sf::IntRect clipArea;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Constructor
+        ///
+        /// \param width   Width of the target, as it would be reported to the gui
+        /// \param height  Height of the target
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RecordingTarget(unsigned int width, unsigned int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the size of the target, as passed to the constructor.
+        ///
+        /// \return Size of the target
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2u getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Forgets everything that was recorded, so that the next frame can be recorded.
+        ///
+        /// The gui calls this function itself at the beginning of its draw function.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Records the draw calls that would be needed to draw an object.
+        ///
+        /// \param drawable  Object that would be drawn
+        /// \param states    Render states that would be used
+        ///
+        /// Sprites, texts, shapes and vertex arrays are recorded with the amount of vertices that SFML would use for them.
+        /// Other objects are recorded as a single draw call without vertices.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void record(const sf::Drawable& drawable, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Records a draw call of vertices.
+        ///
+        /// \param vertices     Vertices that would be drawn
+        /// \param vertexCount  Amount of vertices in the array
+        /// \param type         Type of primitives to draw
+        /// \param states       Render states that would be used
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void record(const sf::Vertex* vertices, unsigned int vertexCount, sf::PrimitiveType type, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the clipping area that is stored with the next draw calls.
+        ///
+        /// \param area  Visible area in pixels, with the origin in the top left corner of the target
+        ///
+        /// This is called by the gui instead of changing the scissor box of OpenGL.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setClipArea(const sf::IntRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the draw calls that were recorded since beginFrame was called.
+        ///
+        /// \return Recorded draw calls, in the order in which they would have been made
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<DrawCommand>& getDrawCommands() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of draw calls that were recorded since beginFrame was called.
+        ///
+        /// \return Amount of draw calls
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of vertices of all draw calls that were recorded since beginFrame was called.
+        ///
+        /// \return Total amount of vertices
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getVertexCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many times a draw call used another texture than the draw call before it.
+        ///
+        /// \return Amount of texture switches since beginFrame was called
+        ///
+        /// Switching from or to drawing without texture is counted as well.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTextureSwitchCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how many times the clipping area changed since beginFrame was called.
+        ///
+        /// \return Amount of clip changes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getClipChangeCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Returns false, which makes sf::RenderTarget skip all OpenGL calls when something is drawn on this target
+        virtual bool activate(bool active);
+
+        // Stores a draw call with the current clipping area
+        void addCommand(sf::PrimitiveType type, unsigned int vertexCount, const sf::Texture* texture, const sf::Transform& transform);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        sf::Vector2u             m_Size;
+        std::vector<DrawCommand> m_Commands;
+
+        sf::IntRect  m_ClipArea;
+        unsigned int m_VertexCount;
+        unsigned int m_TextureSwitches;
+        unsigned int m_ClipChanges;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RECORDING_TARGET_HPP
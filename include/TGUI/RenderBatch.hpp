@@ -0,0 +1,225 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RENDER_BATCH_HPP
+#define TGUI_RENDER_BATCH_HPP
+
+
+#include <vector>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class RecordingTarget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Collects the sprites, rectangles and texts of the widgets and draws them with as few draw calls as possible.
+    ///
+    /// While a batch is active, the widgets don't draw on the render target directly. Their quads are added to a vertex
+    /// list per texture instead, so that e.g. the backgrounds of all buttons that share a texture become a single draw call.
+    /// A quad may join an earlier list with the same texture as long as it doesn't overlap anything that was submitted in
+    /// between, so the result looks exactly as if everything was drawn in submission order.
+    ///
+    /// The lists are drawn when the batch is flushed, which has to happen before the clipping area changes and which
+    /// happens automatically before anything that can't be batched is drawn.
+    ///
+    /// The gui uses a batch while drawing its widgets, you only need this class when writing your own widgets.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderBatch : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RenderBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Makes this the active batch, which collects everything that is drawn on the given target.
+        ///
+        /// \param target  Render target on which the collected quads will be drawn
+        ///
+        /// The draw call counter is reset.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws everything that was collected and makes the previously active batch active again.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws everything that was collected so far.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flush();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether quads are actually combined.
+        ///
+        /// \param enabled  Should quads be combined?
+        ///
+        /// When disabled, everything is drawn immediately like without a batch, but the draw calls are still counted.
+        /// This makes it possible to compare the amount of draw calls with and without batching.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Check if quads are being combined.
+        ///
+        /// \return Is batching enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of draw calls that were made on the render target since begin was called.
+        ///
+        /// \return Amount of draw calls
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws a sprite, through the active batch when it belongs to the target.
+        ///
+        /// \param target  Render target to draw on
+        /// \param sprite  Sprite to draw
+        /// \param states  Render states to use for drawing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws a rectangle, through the active batch when it belongs to the target.
+        ///
+        /// \param target     Render target to draw on
+        /// \param rectangle  Rectangle to draw
+        /// \param states     Render states to use for drawing
+        ///
+        /// Rectangles with an outline or a texture are drawn directly.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::RectangleShape& rectangle, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws a text, through the active batch when it belongs to the target.
+        ///
+        /// \param target  Render target to draw on
+        /// \param text    Text to draw
+        /// \param states  Render states to use for drawing
+        ///
+        /// Every character becomes a quad on the texture of the font. Underlined text is drawn directly.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws anything else directly on the target, after drawing what the active batch collected.
+        ///
+        /// \param target    Render target to draw on
+        /// \param drawable  Object to draw
+        /// \param states    Render states to use for drawing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Draws what the active batch collected, if there is an active batch.
+        ///
+        /// This has to be called before the clipping area is changed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flushActive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Returns the active batch when the object may be added to it, or nullptr when it has to be drawn directly.
+        // The active batch is flushed and the draw call is counted in the latter case.
+        static RenderBatch* getBatchFor(sf::RenderTarget& target, const sf::RenderStates& states);
+
+        // Draws the object on the target without batching it, or records it when the target is a recording target
+        static void drawDirectly(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states);
+
+        // Adds a quad whose vertices are already transformed, the vertices have to be in clockwise or counter-clockwise order
+        void addQuad(const sf::Texture* texture, const sf::Vertex* vertices);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // Quads that share a texture and that can be drawn at the same moment
+        struct Batch
+        {
+            const sf::Texture*      texture;
+            sf::FloatRect           bounds;   // Area covered by all quads, used to decide if later quads may be moved here
+            std::vector<sf::Vertex> vertices;
+        };
+
+        // Only the last few batches are searched for one with the same texture, so that adding a quad stays cheap
+        static const unsigned int MaxBatchesSearched = 8;
+
+        sf::RenderTarget*  m_Target;
+        RecordingTarget*   m_Recorder;   // Same as m_Target when drawing on a recording target, nullptr otherwise
+        RenderBatch*       m_PreviousBatch;
+        bool               m_Enabled;
+        unsigned int       m_DrawCalls;
+
+        // The batches are kept between frames so that their vertices don't have to be allocated again
+        std::vector<Batch> m_Batches;
+        unsigned int       m_BatchCount;
+
+        static RenderBatch* m_ActiveBatch;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_BATCH_HPP
@@ -29,14 +29,62 @@
 
 #include <SFML/System/String.hpp>
 
+#include <TGUI/Config.hpp>
+
 #include <cstddef>
 
+#ifdef TGUI_USE_ATOMIC_REFCOUNT
+    #include <atomic>
+    #include <mutex>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     class Container;
     class Gui;
+    class Widget;
+    class WidgetArena;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The reference count is stored inside the widget. It is only atomic when TGUI_USE_ATOMIC_REFCOUNT is set in cmake,
+    // which is needed when widget pointers are copied on multiple threads at the same time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifdef TGUI_USE_ATOMIC_REFCOUNT
+    typedef std::atomic<unsigned int> ReferenceCount;
+#else
+    typedef unsigned int ReferenceCount;
+#endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Created when the first weak pointer to a widget is made. It stays alive after the widget is destroyed
+    // until all weak pointers are gone, so that they can find out that the widget no longer exists.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct WeakWidgetReference
+    {
+        // The widget, or nullptr when it was destroyed
+        Widget* widget;
+
+        // The amount of weak pointers, plus one as long as the widget exists
+        ReferenceCount count;
+
+#ifdef TGUI_USE_ATOMIC_REFCOUNT
+        // Guards the widget member. Locking a weak pointer holds it while reading the reference count inside the widget,
+        // and the widget destructor takes it before clearing the widget member, so the widget can't be freed in between.
+        std::mutex mutex;
+#endif
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The widget creates its weak reference lazily. With atomic reference counting, two threads making the first weak pointer
+    // to the same widget could both create one, so the pointer is then published with a compare-exchange.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifdef TGUI_USE_ATOMIC_REFCOUNT
+    typedef std::atomic<WeakWidgetReference*> WeakWidgetReferencePtr;
+#else
+    typedef WeakWidgetReference* WeakWidgetReferencePtr;
+#endif
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -67,6 +115,10 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        SharedWidgetPtr(SharedWidgetPtr<T>&& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         template <class U>
         SharedWidgetPtr(const SharedWidgetPtr<U>& copy);
 
@@ -80,12 +132,16 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        SharedWidgetPtr<T>& operator=(SharedWidgetPtr<T>&& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         template <class U>
         SharedWidgetPtr<T>& operator=(const SharedWidgetPtr<U>& copy);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void init();
+        void init(WidgetArena* arena = nullptr);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -187,7 +243,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        unsigned int* getRefCount() const;
+        unsigned int getRefCount() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -197,7 +253,81 @@ namespace tgui
       private:
 
         T* m_WidgetPtr;
-        unsigned int* m_RefCount;
+
+        template <class U>
+        friend class WeakWidgetPtr;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to a widget that doesn't keep the widget alive.
+    ///
+    /// Use lock to get a SharedWidgetPtr to the widget, which will be nullptr when the widget no longer exists.
+    ///
+    /// Usage example:
+    /// \code
+    /// tgui::WeakWidgetPtr<tgui::Button> weakButton = button;
+    /// ...
+    /// tgui::Button::Ptr button = weakButton.lock();
+    /// if (button != nullptr)
+    ///     button->setText("Still here");
+    /// \endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class T>
+    class WeakWidgetPtr
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr(std::nullptr_t);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <class U>
+        WeakWidgetPtr(const SharedWidgetPtr<U>& widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr(const WeakWidgetPtr<T>& copy);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ~WeakWidgetPtr();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WeakWidgetPtr<T>& operator=(const WeakWidgetPtr<T>& copy);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <class U>
+        WeakWidgetPtr<T>& operator=(const SharedWidgetPtr<U>& widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void reset();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool expired() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        SharedWidgetPtr<T> lock() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        T* m_WidgetPtr;
+        WeakWidgetReference* m_Reference;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
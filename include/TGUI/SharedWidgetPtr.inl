@@ -48,8 +48,7 @@ namespace tgui
 
     template <class T>
     SharedWidgetPtr<T>::SharedWidgetPtr(std::nullptr_t) :
-    m_WidgetPtr(nullptr),
-    m_RefCount (nullptr)
+    m_WidgetPtr(nullptr)
     {
     }
 
@@ -59,7 +58,7 @@ namespace tgui
     SharedWidgetPtr<T>::SharedWidgetPtr(Gui& gui, const sf::String& widgetName) :
     m_WidgetPtr(nullptr)
     {
-        init();
+        init(gui.m_Container.getWidgetArena());
         gui.m_Container.add(*this, widgetName);
     }
 
@@ -69,47 +68,39 @@ namespace tgui
     SharedWidgetPtr<T>::SharedWidgetPtr(Container& container, const sf::String& widgetName) :
     m_WidgetPtr(nullptr)
     {
-        init();
+        init(container.getWidgetArena());
         container.add(*this, widgetName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
-    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<T>& copy)
+    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<T>& copy) :
+    m_WidgetPtr(copy.get())
     {
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = copy.get();
+        if (m_WidgetPtr != nullptr)
+            ++m_WidgetPtr->m_ReferenceCount;
+    }
 
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    SharedWidgetPtr<T>::SharedWidgetPtr(SharedWidgetPtr<T>&& other) :
+    m_WidgetPtr(other.m_WidgetPtr)
+    {
+        // Take over the reference, the reference count doesn't change
+        other.m_WidgetPtr = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
     template <class U>
-    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<U>& copy)
+    SharedWidgetPtr<T>::SharedWidgetPtr(const SharedWidgetPtr<U>& copy) :
+    m_WidgetPtr(static_cast<T*>(copy.get()))
     {
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = static_cast<T*>(copy.get());
-
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+        if (m_WidgetPtr != nullptr)
+            ++m_WidgetPtr->m_ReferenceCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,20 +118,30 @@ namespace tgui
     {
         if (this != &copy)
         {
+            // Increment first, the copy might only be kept alive by this pointer
+            T* widget = copy.get();
+            if (widget != nullptr)
+                ++widget->m_ReferenceCount;
+
             reset();
+            m_WidgetPtr = widget;
+        }
 
-            if (copy.get() != nullptr)
-            {
-                m_WidgetPtr = copy.get();
+        return *this;
+    }
 
-                m_RefCount = copy.getRefCount();
-                *m_RefCount += 1;
-            }
-            else
-            {
-                m_WidgetPtr = nullptr;
-                m_RefCount = nullptr;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(SharedWidgetPtr<T>&& other)
+    {
+        if (this != &other)
+        {
+            reset();
+
+            // Take over the reference, the reference count doesn't change
+            m_WidgetPtr = other.m_WidgetPtr;
+            other.m_WidgetPtr = nullptr;
         }
 
         return *this;
@@ -152,20 +153,12 @@ namespace tgui
     template <class U>
     SharedWidgetPtr<T>& SharedWidgetPtr<T>::operator=(const SharedWidgetPtr<U>& copy)
     {
-        reset();
-
-        if (copy.get() != nullptr)
-        {
-            m_WidgetPtr = static_cast<T*>(copy.get());
+        T* widget = static_cast<T*>(copy.get());
+        if (widget != nullptr)
+            ++widget->m_ReferenceCount;
 
-            m_RefCount = copy.getRefCount();
-            *m_RefCount += 1;
-        }
-        else
-        {
-            m_WidgetPtr = nullptr;
-            m_RefCount = nullptr;
-        }
+        reset();
+        m_WidgetPtr = widget;
 
         return *this;
     }
@@ -173,14 +166,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
-    void SharedWidgetPtr<T>::init()
+    void SharedWidgetPtr<T>::init(WidgetArena* arena)
     {
         reset();
 
-        m_RefCount = new unsigned int;
-        *m_RefCount = 1;
-
-        m_WidgetPtr = new T();
+        m_WidgetPtr = new (arena) T();
+        m_WidgetPtr->m_ReferenceCount = 1;
         m_WidgetPtr->m_Callback.widget = get();
     }
 
@@ -191,16 +182,10 @@ namespace tgui
     {
         if (m_WidgetPtr != nullptr)
         {
-            if (*m_RefCount == 1)
-            {
+            if (--m_WidgetPtr->m_ReferenceCount == 0)
                 delete m_WidgetPtr;
-                delete m_RefCount;
 
-                m_WidgetPtr = nullptr;
-                m_RefCount = nullptr;
-            }
-            else
-                *m_RefCount -= 1;
+            m_WidgetPtr = nullptr;
         }
     }
 
@@ -275,9 +260,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <class T>
-    unsigned int* SharedWidgetPtr<T>::getRefCount() const
+    unsigned int SharedWidgetPtr<T>::getRefCount() const
     {
-        return m_RefCount;
+        if (m_WidgetPtr != nullptr)
+            return m_WidgetPtr->m_ReferenceCount;
+        else
+            return 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,10 +277,8 @@ namespace tgui
         {
             SharedWidgetPtr<T> pointer = nullptr;
 
-            pointer.m_RefCount = new unsigned int;
-            *pointer.m_RefCount = 1;
-
             pointer.m_WidgetPtr = m_WidgetPtr->clone();
+            pointer.m_WidgetPtr->m_ReferenceCount = 1;
             pointer.m_WidgetPtr->m_Callback.widget = pointer.get();
             return pointer;
         }
@@ -301,6 +287,178 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::WeakWidgetPtr() :
+    m_WidgetPtr(nullptr),
+    m_Reference(nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::WeakWidgetPtr(std::nullptr_t) :
+    m_WidgetPtr(nullptr),
+    m_Reference(nullptr)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    template <class U>
+    WeakWidgetPtr<T>::WeakWidgetPtr(const SharedWidgetPtr<U>& widget) :
+    m_WidgetPtr(nullptr),
+    m_Reference(nullptr)
+    {
+        *this = widget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::WeakWidgetPtr(const WeakWidgetPtr<T>& copy) :
+    m_WidgetPtr(copy.m_WidgetPtr),
+    m_Reference(copy.m_Reference)
+    {
+        if (m_Reference != nullptr)
+            ++m_Reference->count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>::~WeakWidgetPtr()
+    {
+        reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    WeakWidgetPtr<T>& WeakWidgetPtr<T>::operator=(const WeakWidgetPtr<T>& copy)
+    {
+        if (this != &copy)
+        {
+            if (copy.m_Reference != nullptr)
+                ++copy.m_Reference->count;
+
+            reset();
+            m_WidgetPtr = copy.m_WidgetPtr;
+            m_Reference = copy.m_Reference;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    template <class U>
+    WeakWidgetPtr<T>& WeakWidgetPtr<T>::operator=(const SharedWidgetPtr<U>& widget)
+    {
+        reset();
+
+        if (widget.get() != nullptr)
+        {
+            // The reference is only created when the first weak pointer to the widget is made
+            Widget* base = widget.get();
+            WeakWidgetReference* reference = base->m_WeakReference;
+            if (reference == nullptr)
+            {
+                reference = new WeakWidgetReference;
+                reference->widget = base;
+                reference->count = 1;
+
+#ifdef TGUI_USE_ATOMIC_REFCOUNT
+                // When another thread created the reference first then that one is used and ours is thrown away
+                WeakWidgetReference* existing = nullptr;
+                if (!base->m_WeakReference.compare_exchange_strong(existing, reference))
+                {
+                    delete reference;
+                    reference = existing;
+                }
+#else
+                base->m_WeakReference = reference;
+#endif
+            }
+
+            m_WidgetPtr = static_cast<T*>(widget.get());
+            m_Reference = reference;
+            ++m_Reference->count;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    void WeakWidgetPtr<T>::reset()
+    {
+        if (m_Reference != nullptr)
+        {
+            if (--m_Reference->count == 0)
+                delete m_Reference;
+
+            m_WidgetPtr = nullptr;
+            m_Reference = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    bool WeakWidgetPtr<T>::expired() const
+    {
+        if (m_Reference == nullptr)
+            return true;
+
+#ifdef TGUI_USE_ATOMIC_REFCOUNT
+        std::lock_guard<std::mutex> lock(m_Reference->mutex);
+#endif
+        return (m_Reference->widget == nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <class T>
+    SharedWidgetPtr<T> WeakWidgetPtr<T>::lock() const
+    {
+        SharedWidgetPtr<T> pointer = nullptr;
+        if (m_Reference == nullptr)
+            return pointer;
+
+#ifdef TGUI_USE_ATOMIC_REFCOUNT
+        // As long as the mutex is held, the destructor of the widget can't finish and the reference count stays readable
+        std::lock_guard<std::mutex> lock(m_Reference->mutex);
+        if (m_Reference->widget == nullptr)
+            return pointer;
+
+        // Once the count reached zero the widget is being destroyed, so only a count that is still in use may be increased
+        unsigned int count = m_WidgetPtr->m_ReferenceCount.load();
+        while (count > 0)
+        {
+            if (m_WidgetPtr->m_ReferenceCount.compare_exchange_weak(count, count + 1))
+            {
+                pointer.m_WidgetPtr = m_WidgetPtr;
+                break;
+            }
+        }
+#else
+        // The widget can still exist while its reference count already reached zero when it is being destroyed
+        if ((m_Reference->widget != nullptr) && (m_WidgetPtr->m_ReferenceCount > 0))
+        {
+            pointer.m_WidgetPtr = m_WidgetPtr;
+            ++m_WidgetPtr->m_ReferenceCount;
+        }
+#endif
+
+        return pointer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
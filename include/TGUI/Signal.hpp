@@ -0,0 +1,287 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_SIGNAL_HPP
+#define TGUI_SIGNAL_HPP
+
+#include <vector>
+#include <utility>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Typed signal that widgets emit when something happens to them.
+    ///
+    /// Unlike the callbacks bound with bindCallbackEx, the handlers receive the data directly as parameters,
+    /// which are passed by reference. The widget doesn't gather the data when no handler is connected.
+    ///
+    /// Usage example:
+    /// \code
+    /// editBox->onTextChanged.connect([](const sf::String& text){ std::cout << text.toAnsiString() << std::endl; });
+    /// \endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    class Signal
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal() :
+        m_ConnectedCount(0),
+        m_Emitting      (0),
+        m_LastId        (0)
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Copy constructor
+        ///
+        /// The copy gets the handlers that are still connected.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal(const Signal& copy) :
+        m_ConnectedCount(0),
+        m_Emitting      (0),
+        m_LastId        (copy.m_LastId)
+        {
+            for (auto it = copy.m_Handlers.cbegin(); it != copy.m_Handlers.cend(); ++it)
+            {
+                if (it->id != 0)
+                    m_Handlers.push_back(*it);
+            }
+
+            m_Handlers.insert(m_Handlers.end(), copy.m_NewHandlers.begin(), copy.m_NewHandlers.end());
+            m_ConnectedCount = static_cast<unsigned int>(m_Handlers.size());
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Overload of assignment operator
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal& operator= (const Signal& right)
+        {
+            // Make sure it is not the same signal, and that none of the handlers are running
+            if ((this != &right) && (m_Emitting == 0))
+            {
+                Signal temp(right);
+
+                std::swap(m_Handlers,       temp.m_Handlers);
+                std::swap(m_ConnectedCount, temp.m_ConnectedCount);
+                std::swap(m_LastId,         temp.m_LastId);
+            }
+
+            return *this;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Connect a handler to the signal.
+        ///
+        /// \param handler  Function that will be called when the signal is emitted
+        ///
+        /// \return Id of the connection, which is needed to disconnect the handler again
+        ///
+        /// When the handler is connected by another handler of this signal, it is only called from the next time the signal is emitted.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connect(const std::function<void(Args...)>& handler)
+        {
+            Handler newHandler;
+            newHandler.id = ++m_LastId;
+            newHandler.function = handler;
+
+            // The list can't grow while the handlers in it are running
+            if (m_Emitting > 0)
+                m_NewHandlers.push_back(newHandler);
+            else
+                m_Handlers.push_back(newHandler);
+
+            ++m_ConnectedCount;
+            return m_LastId;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Disconnect a handler from the signal.
+        ///
+        /// \param id  The id that was returned by the connect function
+        ///
+        /// \return True when the handler was disconnected, false when there was no handler with the given id
+        ///
+        /// A handler can disconnect itself or other handlers while the signal is emitted. Disconnected handlers are no longer called.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool disconnect(unsigned int id)
+        {
+            if (id == 0)
+                return false;
+
+            for (auto it = m_Handlers.begin(); it != m_Handlers.end(); ++it)
+            {
+                if (it->id == id)
+                {
+                    // A handler that may be running is only marked, it is removed after the signal was emitted
+                    if (m_Emitting > 0)
+                        it->id = 0;
+                    else
+                        m_Handlers.erase(it);
+
+                    --m_ConnectedCount;
+                    return true;
+                }
+            }
+
+            for (auto it = m_NewHandlers.begin(); it != m_NewHandlers.end(); ++it)
+            {
+                if (it->id == id)
+                {
+                    m_NewHandlers.erase(it);
+                    --m_ConnectedCount;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Disconnect all handlers from the signal.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disconnectAll()
+        {
+            if (m_Emitting > 0)
+            {
+                for (auto it = m_Handlers.begin(); it != m_Handlers.end(); ++it)
+                    it->id = 0;
+
+                m_NewHandlers.clear();
+            }
+            else
+                m_Handlers.clear();
+
+            m_ConnectedCount = 0;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Check if no handlers are connected to the signal.
+        ///
+        /// \return True when emitting the signal would not call anything
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const
+        {
+            return m_ConnectedCount == 0;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Emit the signal, calling all connected handlers in the order in which they were connected.
+        ///
+        /// The handlers may connect and disconnect handlers of this signal and may even emit it again.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void operator()(Args... args)
+        {
+            // While the handlers are running, m_Handlers is never resized, so the handler that is being called stays where it is
+            ++m_Emitting;
+            for (unsigned int i = 0; i < m_Handlers.size(); ++i)
+            {
+                if (m_Handlers[i].id != 0)
+                    m_Handlers[i].function(args...);
+            }
+
+            if (--m_Emitting == 0)
+                applyDeferredChanges();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the handlers that were disconnected and adds the ones that were connected while the signal was emitted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyDeferredChanges()
+        {
+            if (m_Handlers.size() + m_NewHandlers.size() != m_ConnectedCount)
+            {
+                for (auto it = m_Handlers.begin(); it != m_Handlers.end();)
+                {
+                    if (it->id == 0)
+                        it = m_Handlers.erase(it);
+                    else
+                        ++it;
+                }
+            }
+
+            if (!m_NewHandlers.empty())
+            {
+                m_Handlers.insert(m_Handlers.end(), m_NewHandlers.begin(), m_NewHandlers.end());
+                m_NewHandlers.clear();
+            }
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        struct Handler
+        {
+            unsigned int                 id; // 0 when the handler was disconnected while the signal was being emitted
+            std::function<void(Args...)> function;
+        };
+
+        std::vector<Handler> m_Handlers;
+
+        // Handlers that were connected while the signal was being emitted, they are added to m_Handlers afterwards
+        std::vector<Handler> m_NewHandlers;
+
+        // Amount of handlers that are connected, without the ones that are marked as disconnected
+        unsigned int m_ConnectedCount;
+
+        // How many times the signal is being emitted (a handler can cause the signal to be emitted again)
+        unsigned int m_Emitting;
+
+        unsigned int m_LastId;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SIGNAL_HPP
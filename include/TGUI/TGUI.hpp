@@ -58,6 +58,11 @@
 #include <TGUI/MessageBox.hpp>
 #include <TGUI/Grid.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/ThemeBundle.hpp>
+#include <TGUI/WidgetArena.hpp>
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/ClipStack.hpp>
+#include <TGUI/RecordingTarget.hpp>
 
 #include <TGUI/SharedWidgetPtr.inl>
 
@@ -575,6 +575,12 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the selection point blinks, while the text box is focused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getTimeUntilUpdate(sf::Time& time) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -595,6 +601,12 @@ namespace tgui
         };
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Emitted when the text changed, with the new text as parameter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal<const sf::String&> onTextChanged;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
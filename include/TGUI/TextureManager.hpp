@@ -28,23 +28,109 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
 #include <list>
+#include <map>
+#include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    struct TextureData;
+    struct ImageHandle;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // A part of an image that has to be repeated. OpenGL can only repeat a whole texture, so the part is uploaded separately.
+    // It is created once per part of the image and shared by all textures that repeat that part.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct RepeatedPart
+    {
+        sf::IntRect rect;
+        sf::Texture texture;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // A big texture on which multiple images are packed together, so that they can be drawn without switching textures.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct AtlasPage
+    {
+        AtlasPage() : images(0), usedPixels(0) {}
+
+        sf::Texture  texture;
+        unsigned int images;     // The amount of images on the page that are still loaded
+        unsigned int usedPixels; // The amount of pixels covered by the images that are still loaded
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // The image that was loaded from a file, together with all the textures that were created from it.
+    // The file is only decoded and uploaded once, all parts of the image are views on the same texture.
+    // The decoded pixels are freed after the upload, unless TextureManager::setKeepImagesInMemory(true) was called.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct ImageMapData
+    {
+        ImageMapData() : atlasPage(nullptr) {}
+
+        std::unique_ptr<sf::Image> image;
+        sf::Vector2u      size;
+        std::vector<bool> alphaMask;     // One bit per pixel, false when the pixel is completely transparent
+        sf::Texture  texture;       // Only used when the image wasn't placed on an atlas page
+        AtlasPage*   atlasPage;
+        sf::Vector2i atlasPosition;
+        std::list<RepeatedPart> repeatedParts;
+        std::list<TextureData> data;
+
+        // Lets caches refer to the image without keeping it loaded (only created when a cache asks for it)
+        std::shared_ptr<ImageHandle> handle;
+    };
+
+    typedef std::map<std::string, ImageMapData> ImageMap;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Shared by the image and the caches that refer to it. The caches only hold a weak pointer, which expires when the image
+    // is removed from the texture manager.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct ImageHandle
+    {
+        ImageMap::iterator imageIt;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Remembers which image a texture was loaded from, so that loading it again doesn't have to look up the filename.
+    // It is only used while the texture manager is locked.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct CachedImage
+    {
+        std::weak_ptr<ImageHandle> image;
+        std::string rootPath; // The folder that the filename was relative to
+        sf::IntRect part;     // The part of the image that is used
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     struct TextureData
     {
-        TextureData() : image(nullptr) {}
+        TextureData() : imageData(nullptr), texture(nullptr), repeated(false), users(0) {}
 
-        sf::Image*    image;
-        sf::Texture   texture;
-        sf::IntRect   rect;
+        ImageMapData* imageData;  // Nullptr when the texture wasn't loaded by the texture manager
+        sf::Texture*  texture;    // The texture that the sprite is drawn with (shared with the other parts of the image)
+        sf::Texture   ownTexture; // Only used when this part can't be shared (e.g. when it is smoothed on an atlas page)
+        bool          repeated;   // True when the texture is the shared texture of a repeated part
+        sf::IntRect   rect;       // The part of the image that is used
+        sf::Vector2i  offset;     // Position of the part inside the texture
         std::string   filename;
         unsigned int  users;
+
+        // The place where the texture manager stores this data, so that it never has to be searched.
+        // These iterators are only valid when the imageData pointer isn't a nullptr.
+        ImageMap::iterator               imageIt;
+        std::list<TextureData>::iterator dataIt;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,6 +144,19 @@ namespace tgui
         sf::Vector2u getSize() const;
         bool isTransparentPixel(unsigned int x, unsigned int y);
 
+        // The rect is relative to the part of the image that was loaded, not to the whole texture
+        void setTextureRect(const sf::IntRect& rect);
+
+        void setRepeated(bool repeated);
+        bool isRepeated() const;
+
+        void setSmooth(bool smooth);
+        bool isSmooth() const;
+
+        // Gives this part of the image a texture of its own, when it can no longer share the texture with other images.
+        // When other textures were showing the same part, they keep the shared texture and this texture gets new data.
+        void moveToOwnTexture();
+
         operator const sf::Sprite&() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,11 +166,115 @@ namespace tgui
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // Images that are being decoded by worker threads. The images are only uploaded when TextureManager::finishPreload is called.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct PreloadJob : public sf::NonCopyable
+    {
+        // Starts the worker threads
+        PreloadJob(const std::vector<std::string>& filenamesToLoad);
+
+        // Waits until the worker threads are finished
+        ~PreloadJob();
+
+        // Function that is executed by the worker threads
+        void decode();
+
+        std::vector<std::string> filenames;
+        std::vector<std::unique_ptr<sf::Image>> images;
+        std::vector<char>        decoded;   // Not a vector<bool>, because different threads are writing to it
+
+        std::vector<sf::Thread*> threads;
+        sf::Mutex                mutex;     // Protects nextImage and decodedImages
+
+        std::vector<std::string>::size_type nextImage;
+        std::vector<std::string>::size_type decodedImages;
+
+        std::atomic<bool> uploaded; // Read by PreloadHandle::isFinished without locking the texture manager
+        bool              success;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Handle to images that are being loaded in the background.
+    ///
+    /// \see TextureManager::preload
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PreloadHandle
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether all images have been decoded by the worker threads.
+        ///
+        /// When this function returns true then TextureManager::finishPreload will no longer block.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDecoded() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the images have been uploaded to the graphics card by TextureManager::finishPreload.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isFinished() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the part of the images that has already been decoded.
+        ///
+        /// \return Value between 0 and 1, which can e.g. be shown on a loading bar in a splash screen.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getProgress() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        std::shared_ptr<PreloadJob> m_Job;
+
+        friend class TextureManager;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory that is used by an image that was loaded by the texture manager.
+    ///
+    /// \see TextureManager::getMemoryUsage
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API ImageMemoryUsage
+    {
+        std::string  filename;
+        std::size_t  cpuBytes;  ///< Decoded pixels (when they are kept in memory) and the alpha mask
+        std::size_t  gpuBytes;  ///< Texture memory, including the textures that were created for repeated parts
+        unsigned int users;     ///< Amount of textures that are using the image
+    };
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Loads and shares the images that are used by the widgets.
+    ///
+    /// Threading contract:
+    /// - All functions of the texture manager, and the functions of Texture that change the shared texture data, can be
+    ///   called from multiple threads at the same time. Widgets can thus be loaded on worker threads.
+    /// - A widget (and its textures) should only be used by one thread at a time. A widget tree that was created on a
+    ///   worker thread can be handed over to the thread that owns the Gui once it is completely loaded.
+    /// - Textures that are created on a worker thread are usable on the main thread, because SFML flushes the OpenGL
+    ///   commands after every upload. The worker thread does need an OpenGL context, which SFML creates automatically.
+    /// - ConfigFile::flushCache should not be called while widgets are being loaded.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API TextureManager : public sf::NonCopyable
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextureManager();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Loads a texture.
         ///
@@ -80,17 +283,29 @@ namespace tgui
         /// \param rect      Load only part of the image. Don't pass this parameter if you want to load the full image.
         ///
         /// The second time you call this function with the same filename, the previously loaded image will be reused.
+        /// Every file is only decoded and uploaded to the graphics card once, the texture only contains a view on the
+        /// requested part of it.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool getTexture(const std::string& filename, Texture& texture, const sf::IntRect& rect = sf::IntRect(0, 0, 0, 0));
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Loads a texture like the other getTexture function, but the image is remembered in the cache. As long as the image
+        // stays loaded, the next call with the same cache doesn't have to build the filename or search for it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getTexture(CachedImage& cache, const std::string& rootPath, const std::string& filename, Texture& texture, const sf::IntRect& rect);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Share the image with another texture.
         ///
         /// \param textureToCopy  The original texture.
         /// \param newTexture     The texture that will get the same image as the texture that is being copied
         ///
+        /// This function runs in constant time, no matter how many images were loaded.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool copyTexture(const Texture& textureToCopy, Texture& newTexture);
 
@@ -101,21 +316,247 @@ namespace tgui
         /// \param textureToRemove  The texture that should be removed.
         ///
         /// When no other texture is using the same image then the image will be removed from memory.
+        /// This function runs in constant time, no matter how many images were loaded.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void removeTexture(Texture& textureToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Loads images and packs them together on a few big textures.
+        ///
+        /// \param filenames  Filenames of the images to load.
+        ///
+        /// \return True when all images were loaded, false when some of them couldn't be loaded.
+        ///
+        /// Textures that are later loaded from these images will all point into the atlas, so that the widgets can be drawn
+        /// without constantly switching between textures. Images that were already loaded before are left untouched.
+        ///
+        /// This function is automatically called with all images that are referenced by a config file, the first time that
+        /// a widget is loaded from it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool buildAtlas(const std::vector<std::string>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the texture manager that a part of an image is going to be repeated.
+        ///
+        /// \param filename  Filename of the image.
+        /// \param rect      Part of the image that will be repeated, in the same format as in getTexture.
+        ///
+        /// A part of a bigger texture can't be repeated by the graphics card, so a repeated part needs a texture of its own.
+        /// That texture is created from the decoded pixels when the image is uploaded, and is then shared by all textures
+        /// that repeat the same part. Without this hint, the pixels may have to be decoded or read back again later.
+        ///
+        /// This function is automatically called for the middle images (the properties ending with _M) of a config file,
+        /// the first time that a widget is loaded from it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addRepeatedPart(const std::string& filename, const sf::IntRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Starts decoding images in the background.
+        ///
+        /// \param filenames  Filenames of the images to load.
+        ///
+        /// \return Handle that can be used to check if the images are decoded.
+        ///
+        /// The images are decoded on worker threads (one per core), which makes it possible to load a whole theme while a
+        /// splash screen is being shown. Nothing is uploaded to the graphics card until finishPreload is called, which has
+        /// to be done from the thread that uses the texture manager.
+        ///
+        /// Images that are still being decoded will never be decoded twice: when a widget needs one of them, the texture
+        /// manager simply waits for the preload to finish.
+        ///
+        /// Usage example:
+        /// \code
+        /// tgui::PreloadHandle handle = TGUI_TextureManager.preload(filenames);
+        /// while (!handle.isDecoded())
+        ///     drawSplashScreen(handle.getProgress());
+        /// TGUI_TextureManager.finishPreload(handle);
+        /// \endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PreloadHandle preload(const std::vector<std::string>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Uploads the images that were decoded in the background.
+        ///
+        /// \param handle  Handle that was returned by the preload function.
+        ///
+        /// \return True when all images were loaded, false when some of them couldn't be loaded.
+        ///
+        /// This function blocks until all images are decoded. The images are packed together like in buildAtlas.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool finishPreload(const PreloadHandle& handle);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Frees the images that were loaded by buildAtlas or preload but that no texture is using.
+        ///
+        /// Images that are loaded with getTexture are freed as soon as the last texture that uses them is removed. Images
+        /// that were only packed or preloaded were never requested, so they stay loaded until this function is called.
+        /// An atlas page is freed once none of the images on it are loaded anymore.
+        ///
+        /// This function is called by ConfigFile::flushCache, which forgets the images of the themes that were loaded.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeUnusedImages();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes whether the decoded pixels are kept in memory after they were uploaded to the graphics card.
+        ///
+        /// \param keep  Should the pixels be kept in memory?
+        ///
+        /// By default the pixels are freed after the upload. Transparency checks use an alpha mask that only needs one bit
+        /// per pixel, and the few operations that still need the pixels will read them back from the graphics card.
+        /// Keeping the pixels in memory only speeds up those rare operations.
+        ///
+        /// When setting this to false, the pixels of all images that are already loaded are freed immediately.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setKeepImagesInMemory(bool keep);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns whether the decoded pixels are kept in memory after they were uploaded to the graphics card.
+        ///
+        /// \see setKeepImagesInMemory
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getKeepImagesInMemory() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns how much memory is used by every loaded image.
+        ///
+        /// \return List with one entry per image file.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<ImageMemoryUsage> getMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of textures that are currently stored on the graphics card.
+        ///
+        /// Every atlas page counts as one texture, no matter how many images are placed on it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTextureCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns which part of the atlas pages is covered by images.
+        ///
+        /// \return Value between 0 and 1, or 0 when there are no atlas pages.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAtlasFillRatio() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
-        struct ImageMapData
-        {
-            sf::Image image;
-            std::list<TextureData> data;
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads the decoded images to the graphics card, packed together on atlas pages when possible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool uploadImages(std::vector<ImageMap::iterator> images);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the alpha mask of an image that was just uploaded, and frees the pixels when they are no longer needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void imageUploaded(ImageMap::iterator imageIt);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the textures of the parts that are known to be repeated, from the decoded pixels of the image.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createRepeatedParts(ImageMap::iterator imageIt, const sf::Image& image);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the texture of a repeated part, which is created when it didn't exist yet. Returns nullptr on failure.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Texture* getRepeatedPart(ImageMap::iterator imageIt, const sf::IntRect& part);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the data that is shared by all textures showing this part of the image. The data is added when needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextureData* getTextureData(ImageMap::iterator imageIt, const sf::IntRect& part, bool repeated);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Lets the texture use the shared data of its part that is (or isn't) repeated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void switchTextureData(Texture& texture, bool repeated);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds out which part of the image is needed (the same way as sf::Texture::loadFromImage does it)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::IntRect getPart(const sf::Vector2u& imageSize, const sf::IntRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finishes the preload that is decoding the image, if there is one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishPreloadOfImage(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Chooses the page width on which the most images fit in the smallest area. The sizes already include the padding.
+        // Returns the size of the page, the positions of the images that fit on it are stored in the positions parameter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::Vector2u planAtlasPage(const std::vector<sf::Vector2u>& sizes, unsigned int maxPageSize, std::vector<sf::Vector2u>& positions);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the images on a page with the given width, with a skyline packer. The images are placed in order until the
+        // first one that doesn't fit anymore. The positions of the placed images and the part of the page they cover are returned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void packImages(const std::vector<sf::Vector2u>& sizes, unsigned int pageWidth, unsigned int maxPageHeight,
+                               std::vector<sf::Vector2u>& positions, sf::Vector2u& usedSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the image from the map and from the atlas page on which it was placed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeImage(ImageMap::iterator imageIt);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        ImageMap m_ImageMap;
+
+        std::list<AtlasPage> m_AtlasPages;
+
+        std::list<std::shared_ptr<PreloadJob>> m_Preloads;
+
+        // The parts of the images that are known to be repeated, also for images that aren't loaded yet
+        std::map<std::string, std::vector<sf::IntRect>> m_RepeatedParts;
+
+        bool m_KeepImagesInMemory;
+
+        // Protects everything in the texture manager, including the data that is shared between the textures.
+        // Sfml mutexes are recursive, so functions holding the lock can call each other.
+        mutable sf::Mutex m_Mutex;
+
+        friend struct Texture;
+        friend class ThemeBundle;
+
+        // Empty space that is kept around every image in the atlas
+        static const unsigned int AtlasPadding = 1;
 
-        std::map<std::string, ImageMapData> m_ImageMap;
+        // Size that an atlas page will never exceed (unless the graphics card has a smaller limit)
+        static const unsigned int MaxAtlasPageSize = 2048;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
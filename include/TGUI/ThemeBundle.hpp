@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_THEME_BUNDLE_HPP
+#define TGUI_THEME_BUNDLE_HPP
+
+
+#include <TGUI/ConfigFile.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \internal
+    // A read-only file that is mapped into memory, so that it can be read without copying it.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MappedFile : public sf::NonCopyable
+    {
+      public:
+
+        MappedFile();
+
+        // Unmaps the file
+        ~MappedFile();
+
+        bool open(const std::string& filename);
+        void close();
+
+        const char* getData() const;
+        std::size_t getSize() const;
+
+      private:
+
+        const char* m_Data;
+        std::size_t m_Size;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Precompiled theme that can be loaded without parsing config files or decoding images.
+    ///
+    /// A bundle contains a config file, all config files that it references and all images that they use. The properties
+    /// are stored already parsed and the images are stored as raw pixels, already packed together on atlas pages.
+    ///
+    /// Bundles are created offline with the tgui-theme-compiler tool (enable TGUI_BUILD_THEME_COMPILER in cmake):
+    /// \code
+    /// tgui-theme-compiler widgets/Black.conf widgets/Black.tguibundle
+    /// \endcode
+    ///
+    /// The bundle has to be loaded before any widget is loaded from the theme. The widgets are then loaded as usual:
+    /// \code
+    /// tgui::ThemeBundle::load("widgets/Black.tguibundle", "widgets/");
+    /// button->load("widgets/Black.conf"); // Doesn't touch Black.conf or Black.png anymore
+    /// \endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ThemeBundle
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Compiles a theme into a bundle.
+        ///
+        /// \param configFilename  Filename of the config file of the theme.
+        /// \param bundleFilename  Filename of the bundle that will be written.
+        ///
+        /// \return True when the bundle was written, false when the theme couldn't be read or the bundle couldn't be written.
+        ///
+        /// The config files that are referenced by the theme (e.g. for the scrollbars) are included in the bundle.
+        /// All filenames are stored relative to the folder of the config file.
+        ///
+        /// This function doesn't need an OpenGL context, nothing is uploaded to the graphics card.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool compile(const std::string& configFilename, const std::string& bundleFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Loads a compiled theme.
+        ///
+        /// \param bundleFilename  Filename of the bundle.
+        /// \param themeFolder     The folder of the original config file, as it will be passed to the load function of the
+        ///                        widgets (including the resource path). The filenames in the bundle are relative to it.
+        ///
+        /// \return True when the bundle was loaded, false when it couldn't be read or is corrupt.
+        ///
+        /// The bundle is mapped into memory and the atlas pages are uploaded straight from the mapped pixels. The config
+        /// files and images end up in the same caches as when they would have been loaded from disk, so the widgets are
+        /// loaded from the bundle without any change. Config files and images that were already loaded are left untouched.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool load(const std::string& bundleFilename, const std::string& themeFolder);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads the config file and all config files referenced by it. The filenames are relative to the root folder.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool readConfigFiles(const std::string& rootFolder, const std::string& configFilename,
+                                    std::map<std::string, std::map<std::string, ConfigSection>>& configFiles);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks if the filename in a value refers to another config file instead of to an image.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isConfigFilename(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Functions to write the values in the bundle in little endian, independent of the platform
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void writeUint32(std::ofstream& file, sf::Uint32 value);
+        static void writeString(std::ofstream& file, const std::string& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Functions to read the values from the bundle. They return false when the end of the data is reached.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool readUint32(const char*& data, const char* end, sf::Uint32& value);
+        static bool readString(const char*& data, const char* end, std::string& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // The first bytes of every bundle, followed by the version of the format
+        static const char       Magic[8];
+        static const sf::Uint32 Version = 1;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_THEME_BUNDLE_HPP
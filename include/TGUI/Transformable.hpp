@@ -197,6 +197,15 @@ namespace tgui
         const sf::Transform& getTransform() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called when the position or size of the object has changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void boundsChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -32,12 +32,15 @@
 #include <TGUI/Callback.hpp>
 #include <TGUI/Transformable.hpp>
 #include <TGUI/SharedWidgetPtr.hpp>
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/ClipStack.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     class Container;
+    class WidgetArena;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief The parent class for every widget.
@@ -83,6 +86,37 @@ namespace tgui
         Widget& operator= (const Widget& right);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Allocates memory for a widget on the heap.
+        ///
+        /// Widgets that are created through a SharedWidgetPtr inside a container with a widget arena are allocated with
+        /// the other overload instead. You never have to call these functions yourself.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void* operator new(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Allocates memory for a widget from a widget arena, or from the heap when arena is nullptr.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void* operator new(std::size_t size, WidgetArena* arena);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Gives the memory of a widget back to the heap or to the widget arena that it came from.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void operator delete(void* memory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Gives the memory back when the constructor of a widget that was allocated from an arena throws.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void operator delete(void* memory, WidgetArena* arena);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget by just calling the copy constructor.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -214,6 +248,29 @@ namespace tgui
         bool isFocused() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Changes the place of the widget in the order in which widgets are focused with the tab key.
+        ///
+        /// \param tabIndex  Position of the widget in the tab order
+        ///
+        /// Within a container, widgets with a lower tab index are focused before widgets with a higher tab index.
+        /// Widgets with the same tab index are focused in the order in which they were added. The tab index is 0 by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTabIndex(int tabIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the place of the widget in the order in which widgets are focused with the tab key.
+        ///
+        /// \return Position of the widget in the tab order
+        ///
+        /// \see setTabIndex
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getTabIndex() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Returns the type of the widget.
         ///
@@ -302,6 +359,13 @@ namespace tgui
         virtual void update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how much time has to pass, counted from the last call to update, before update changes how the widget looks.
+        // Widgets that won't change by themselves return false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getTimeUntilUpdate(sf::Time& time) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // The widgets use this function to send their callbacks to their parent and/or to a callback function.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -309,22 +373,68 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called when the mouse enters the widget. If requested, a callback will be send.
+        // This function is called when the mouse enters the widget. A widget with hover images has to be redrawn and, if requested, a callback will be send.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void mouseEnteredWidget();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function is called when the mouse leaves the widget. If requested, a callback will be send.
+        // This function is called when the mouse leaves the widget. A widget with hover images has to be redrawn and, if requested, a callback will be send.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called when the position or size of the widget has changed.
+        // When the widget has a parent, the parent will have to update its hit-testing index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void boundsChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called on the parent of a widget when the position or size of that widget has changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childBoundsChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function has to be called when the widget can no longer be focused with the tab key or when it now can be.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void focusableChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called on the parent of a widget when that widget can no longer be focused or when it now can be.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childFocusableChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function has to be called when something changed that affects how the widget looks.
+        // Containers that keep their contents in a render cache will redraw that cache before the next frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void appearanceChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(float x, float y) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the area outside of which mouseOnWidget will never return true.
+        // Widgets that have no such area return false and will always be checked by their parent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getMouseBounds(sf::FloatRect& bounds) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \internal
+        // Returns the area outside of which the widget never draws, in the same coordinates as the mouse bounds.
+        // Widgets that return false are always drawn. The area may only change when boundsChanged is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool getDrawBounds(sf::FloatRect& bounds) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// \internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,6 +554,9 @@ namespace tgui
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_Parent;
 
+        // The slot in which the parent stores this widget, so that the parent doesn't have to search for it
+        unsigned int m_ContainerSlot;
+
         // How transparent is the widget
         unsigned char m_Opacity;
 
@@ -457,6 +570,9 @@ namespace tgui
         // Can the widget be focused?
         bool m_AllowFocus;
 
+        // Position of the widget in the tab order of its parent
+        int m_TabIndex;
+
         // Keep track of the elapsed time.
         bool m_AnimatedWidget;
         sf::Time m_AnimationTimeElapsed;
@@ -467,10 +583,22 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_ContainerWidget;
 
+        // The amount of SharedWidgetPtr objects that point to this widget
+        ReferenceCount m_ReferenceCount;
+
+        // Shared with the weak pointers to this widget, nullptr when no weak pointer was ever made
+        WeakWidgetReferencePtr m_WeakReference;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container;
+
+        template <class T>
+        friend class SharedWidgetPtr;
+
+        template <class T>
+        friend class WeakWidgetPtr;
     };
 
 
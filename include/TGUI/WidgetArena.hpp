@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_WIDGET_ARENA_HPP
+#define TGUI_WIDGET_ARENA_HPP
+
+
+#include <vector>
+
+#include <TGUI/Global.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Pool from which the widgets of a container (and the containers inside it) are allocated.
+    ///
+    /// Memory is taken from large blocks and freed widgets are kept in a free list per size, so building and destroying
+    /// many widgets doesn't go through the global allocator for every widget. When the last widget from the arena is
+    /// destroyed (e.g. after removeAllWidgets) all blocks are released at once.
+    ///
+    /// You don't create an arena yourself, call setWidgetArenaEnabled on a container or on the gui instead.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WidgetArena : public sf::NonCopyable
+    {
+      public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Constructor
+        ///
+        /// \param blockSize  Amount of bytes that are allocated at once when the arena runs out of memory
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetArena(std::size_t blockSize = 64 * 1024);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Allocates memory for a widget.
+        ///
+        /// \param size  Amount of bytes needed
+        ///
+        /// \return Pointer to the memory, aligned like memory returned by operator new
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void* allocate(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Gives memory back to the arena.
+        ///
+        /// \param memory  Pointer that was returned by allocate
+        /// \param size    The size that was passed to allocate
+        ///
+        /// When this was the last allocation then all blocks are released. The arena destroys itself when there are
+        /// no allocations left and nothing refers to it anymore.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deallocate(void* memory, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the arena that a container is using it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addReference();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Tells the arena that a container no longer uses it.
+        ///
+        /// The arena destroys itself when no container refers to it and all its memory was given back.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeReference();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of widgets that are currently allocated from the arena.
+        ///
+        /// \return Amount of allocations that haven't been given back yet
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getAllocationCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Returns the amount of large blocks that the arena currently holds.
+        ///
+        /// \return Amount of blocks
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getBlockCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Only the arena itself may destroy it, once it is no longer used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~WidgetArena();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Frees all blocks and forgets the free lists
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseBlocks();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      private:
+
+        // All sizes are rounded up to a multiple of this value
+        static const std::size_t Granularity = 16;
+
+        std::size_t m_BlockSize;
+
+        // The blocks that were allocated and the unused part of the last one
+        std::vector<char*> m_Blocks;
+        char*              m_BlockPosition;
+        std::size_t        m_BlockRemaining;
+
+        // Linked lists of freed memory, one per size (the index is the size divided by the granularity)
+        std::vector<void*> m_FreeLists;
+
+        unsigned int m_Allocations;
+        unsigned int m_References;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_ARENA_HPP
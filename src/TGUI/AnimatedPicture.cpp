@@ -106,6 +106,8 @@ namespace tgui
 
     bool AnimatedPicture::addFrame(const std::string& filename, sf::Time frameDuration)
     {
+        appearanceChanged();
+
         // Check if the filename is empty
         if (filename.empty())
             return false;
@@ -122,6 +124,7 @@ namespace tgui
 
                 // Remember the size of this image
                 m_Size = sf::Vector2f(tempTexture.getSize());
+                boundsChanged();
             }
 
             // Add the texture
@@ -144,6 +147,7 @@ namespace tgui
     {
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +164,8 @@ namespace tgui
 
     void AnimatedPicture::play()
     {
+        appearanceChanged();
+
         // You can't start playing when no frames were loaded
         if (m_Textures.empty())
             return;
@@ -176,6 +182,7 @@ namespace tgui
     void AnimatedPicture::pause()
     {
         m_Playing = false;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,12 +195,16 @@ namespace tgui
             m_CurrentFrame = -1;
         else
             m_CurrentFrame = 0;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool AnimatedPicture::setFrame(unsigned int frame)
     {
+        appearanceChanged();
+
         // Check if there are no frames
         if (m_Textures.empty() == true)
         {
@@ -245,6 +256,8 @@ namespace tgui
 
     bool AnimatedPicture::removeFrame(unsigned int frame)
     {
+        appearanceChanged();
+
         // Make sure the number isn't too high
         if (frame >= m_Textures.size())
             return false;
@@ -280,6 +293,8 @@ namespace tgui
         // Reset the animation
         stop();
         m_Loaded = false;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,6 +302,7 @@ namespace tgui
     void AnimatedPicture::setLooping(bool loop)
     {
         m_Looping = loop;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -374,7 +390,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(AnimationFinished) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(AnimationFinished).size() == 1) && (m_CallbackFunctions.at(AnimationFinished).front() == nullptr))
+            if (isOnlyBoundToParent(AnimationFinished))
                 callbacks.push_back("AnimationFinished");
 
             encodeList(callbacks, value);
@@ -417,6 +433,7 @@ namespace tgui
             {
                 // Decrease the elapsed time
                 m_AnimationTimeElapsed -= m_FrameDuration[m_CurrentFrame];
+                appearanceChanged();
 
                 // Make the next frame visible
                 if (static_cast<unsigned int>(m_CurrentFrame + 1) < m_Textures.size())
@@ -434,7 +451,7 @@ namespace tgui
                     }
 
                     // The animation has finished, send a callback if needed
-                    if (m_CallbackFunctions[AnimationFinished].empty() == false)
+                    if (isCallbackBound(AnimationFinished))
                     {
                         m_Callback.trigger = AnimationFinished;
                         addCallback();
@@ -449,13 +466,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool AnimatedPicture::getTimeUntilUpdate(sf::Time& time) const
+    {
+        if ((m_Playing == false) || (m_CurrentFrame < 0))
+            return false;
+
+        // A frame without duration remains visible until the animation is changed
+        const sf::Time& duration = m_FrameDuration[m_CurrentFrame];
+        if (duration.asMicroseconds() <= 0)
+            return false;
+
+        if (m_AnimationTimeElapsed < duration)
+            time = duration - m_AnimationTimeElapsed;
+        else
+            time = sf::Time::Zero;
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void AnimatedPicture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_Loaded)
         {
             states.transform *= getTransform();
             states.transform.scale(m_Size.x / m_Textures[m_CurrentFrame].getSize().x, m_Size.y / m_Textures[m_CurrentFrame].getSize().y);
-            target.draw(m_Textures[m_CurrentFrame], states);
+            RenderBatch::draw(target, m_Textures[m_CurrentFrame], states);
         }
     }
 
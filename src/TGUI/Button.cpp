@@ -131,6 +131,8 @@ namespace tgui
 
     bool Button::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -158,10 +160,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("Button", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("Button");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -177,10 +178,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "separatehoverimage")
             {
@@ -336,7 +337,7 @@ namespace tgui
                 setSize(static_cast<float>(m_TextureNormal_L.getSize().x + m_TextureNormal_M.getSize().x + m_TextureNormal_R.getSize().x),
                         static_cast<float>(m_TextureNormal_M.getSize().y));
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -348,21 +349,22 @@ namespace tgui
             if ((m_TextureFocused_L.data != nullptr) && (m_TextureFocused_M.data != nullptr) && (m_TextureFocused_R.data != nullptr))
             {
                 m_AllowFocus = true;
+                focusableChanged();
                 m_WidgetPhase |= WidgetPhase_Focused;
 
-                m_TextureFocused_M.data->texture.setRepeated(true);
+                m_TextureFocused_M.setRepeated(true);
             }
             if ((m_TextureHover_L.data != nullptr) && (m_TextureHover_M.data != nullptr) && (m_TextureHover_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureHover_M.data->texture.setRepeated(true);
+                m_TextureHover_M.setRepeated(true);
             }
             if ((m_TextureDown_L.data != nullptr) && (m_TextureDown_M.data != nullptr) && (m_TextureDown_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_MouseDown;
 
-                m_TextureDown_M.data->texture.setRepeated(true);
+                m_TextureDown_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -383,6 +385,7 @@ namespace tgui
             if (m_TextureFocused_M.data != nullptr)
             {
                 m_AllowFocus = true;
+                focusableChanged();
                 m_WidgetPhase |= WidgetPhase_Focused;
             }
             if (m_TextureHover_M.data != nullptr)
@@ -465,6 +468,7 @@ namespace tgui
         // Set the new size of the button
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         // A negative size is not allowed for this widget
         if (m_Size.x < 0) m_Size.x = -m_Size.x;
@@ -488,10 +492,10 @@ namespace tgui
             m_TextureNormal_L.sprite.setScale(scalingY, scalingY);
             m_TextureFocused_L.sprite.setScale(scalingY, scalingY);
 
-            m_TextureDown_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureDown_M.getSize().y));
-            m_TextureHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
-            m_TextureNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
-            m_TextureFocused_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
+            m_TextureDown_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureDown_M.getSize().y));
+            m_TextureHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
+            m_TextureNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
+            m_TextureFocused_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
 
             m_TextureDown_M.sprite.setScale(scalingY, scalingY);
             m_TextureHover_M.sprite.setScale(scalingY, scalingY);
@@ -519,6 +523,8 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        appearanceChanged();
+
         // Don't do anything when the button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -564,6 +570,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text.getString());
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,6 +586,7 @@ namespace tgui
     void Button::setTextColor(const sf::Color& color)
     {
         m_Text.setColor(color);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -596,6 +605,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text.getString());
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -639,7 +650,7 @@ namespace tgui
         if (event.code == sf::Keyboard::Space)
         {
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[SpaceKeyPressed].empty() == false)
+            if (isCallbackBound(SpaceKeyPressed))
             {
                 m_Callback.trigger = SpaceKeyPressed;
                 addCallback();
@@ -648,7 +659,7 @@ namespace tgui
         else if (event.code == sf::Keyboard::Return)
         {
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ReturnKeyPressed].empty() == false)
+            if (isCallbackBound(ReturnKeyPressed))
             {
                 m_Callback.trigger = ReturnKeyPressed;
                 addCallback();
@@ -732,9 +743,9 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(SpaceKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(SpaceKeyPressed).size() == 1) && (m_CallbackFunctions.at(SpaceKeyPressed).front() == nullptr))
+            if (isOnlyBoundToParent(SpaceKeyPressed))
                 callbacks.push_back("SpaceKeyPressed");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+            if (isOnlyBoundToParent(ReturnKeyPressed))
                 callbacks.push_back("ReturnKeyPressed");
 
             encodeList(callbacks, value);
@@ -781,53 +792,53 @@ namespace tgui
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_L, states);
-                    target.draw(m_TextureDown_M, states);
-                    target.draw(m_TextureDown_R, states);
+                    RenderBatch::draw(target, m_TextureDown_L, states);
+                    RenderBatch::draw(target, m_TextureDown_M, states);
+                    RenderBatch::draw(target, m_TextureDown_R, states);
                 }
                 else if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    RenderBatch::draw(target, m_TextureHover_L, states);
+                    RenderBatch::draw(target, m_TextureHover_M, states);
+                    RenderBatch::draw(target, m_TextureHover_R, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    RenderBatch::draw(target, m_TextureNormal_L, states);
+                    RenderBatch::draw(target, m_TextureNormal_M, states);
+                    RenderBatch::draw(target, m_TextureNormal_R, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_L, states);
-                    target.draw(m_TextureDown_M, states);
-                    target.draw(m_TextureDown_R, states);
+                    RenderBatch::draw(target, m_TextureDown_L, states);
+                    RenderBatch::draw(target, m_TextureDown_M, states);
+                    RenderBatch::draw(target, m_TextureDown_R, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    RenderBatch::draw(target, m_TextureNormal_L, states);
+                    RenderBatch::draw(target, m_TextureNormal_M, states);
+                    RenderBatch::draw(target, m_TextureNormal_R, states);
                 }
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    RenderBatch::draw(target, m_TextureHover_L, states);
+                    RenderBatch::draw(target, m_TextureHover_M, states);
+                    RenderBatch::draw(target, m_TextureHover_R, states);
                 }
             }
 
             // When the button is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_L, states);
-                target.draw(m_TextureFocused_M, states);
-                target.draw(m_TextureFocused_R, states);
+                RenderBatch::draw(target, m_TextureFocused_L, states);
+                RenderBatch::draw(target, m_TextureFocused_M, states);
+                RenderBatch::draw(target, m_TextureFocused_R, states);
             }
         }
         else // The images aren't split
@@ -836,44 +847,44 @@ namespace tgui
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_M, states);
+                    RenderBatch::draw(target, m_TextureDown_M, states);
                 }
                 else if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_M, states);
+                    RenderBatch::draw(target, m_TextureHover_M, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    RenderBatch::draw(target, m_TextureNormal_M, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
                 if ((m_MouseDown) && (m_MouseHover) && (m_WidgetPhase & WidgetPhase_MouseDown))
                 {
-                    target.draw(m_TextureDown_M, states);
+                    RenderBatch::draw(target, m_TextureDown_M, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    RenderBatch::draw(target, m_TextureNormal_M, states);
                 }
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_M, states);
+                    RenderBatch::draw(target, m_TextureHover_M, states);
                 }
             }
 
             // When the button is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_M, states);
+                RenderBatch::draw(target, m_TextureFocused_M, states);
             }
         }
 
         // If the button has a text then also draw the text
-        target.draw(m_Text, states);
+        RenderBatch::draw(target, m_Text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
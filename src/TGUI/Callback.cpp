@@ -31,69 +31,209 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    CallbackManager::CallbackManager() :
+    m_SendingCallbacks    (0),
+    m_UnbindCount         (0),
+    m_BoundTriggers       (0),
+    m_CallbackDataTriggers(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CallbackManager::CallbackManager(const CallbackManager& copy) :
+    m_SendingCallbacks    (0),
+    m_UnbindCount         (0),
+    m_BoundTriggers       (copy.m_BoundTriggers),
+    m_CallbackDataTriggers(copy.m_CallbackDataTriggers),
+    m_Callback            (copy.m_Callback)
+    {
+        // The copy isn't sending any callbacks, so it only gets the functions that are still bound
+        for (auto it = copy.m_CallbackFunctions.cbegin(); it != copy.m_CallbackFunctions.cend(); ++it)
+        {
+            if (it->unbound == 0)
+                m_CallbackFunctions.push_back(*it);
+        }
+
+        m_CallbackFunctions.insert(m_CallbackFunctions.end(), copy.m_DeferredCallbackFunctions.begin(), copy.m_DeferredCallbackFunctions.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CallbackManager& CallbackManager::operator= (const CallbackManager& right)
+    {
+        // Make sure it is not the same widget, and that none of the functions are running
+        if ((this != &right) && (m_SendingCallbacks == 0))
+        {
+            CallbackManager temp(right);
+
+            std::swap(m_CallbackFunctions,      temp.m_CallbackFunctions);
+            std::swap(m_BoundTriggers,          temp.m_BoundTriggers);
+            std::swap(m_CallbackDataTriggers,   temp.m_CallbackDataTriggers);
+            std::swap(m_Callback,               temp.m_Callback);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void CallbackManager::bindCallback(std::function<void()> func, unsigned int trigger)
     {
-        mapCallback(func, trigger);
+        mapCallback(func, trigger, false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void CallbackManager::bindCallbackEx(std::function<void(const Callback&)> func, unsigned int trigger)
     {
-        mapCallback(std::bind(func, std::ref(m_Callback)), trigger);
+        mapCallback(std::bind(func, std::ref(m_Callback)), trigger, true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void CallbackManager::bindCallback(unsigned int trigger)
     {
-        mapCallback(nullptr, trigger);
+        mapCallback(nullptr, trigger, true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void CallbackManager::unbindCallback(unsigned int trigger)
     {
-        unsigned int counter = 1;
-        while (counter * 2 <= trigger)
-            counter *= 2;
-
-        while (counter > 0)
+        if (m_SendingCallbacks > 0)
         {
-            if (trigger >= counter)
+            // The functions can't be removed while one of them may be running, they are removed when the callbacks are sent
+            ++m_UnbindCount;
+            for (auto it = m_CallbackFunctions.begin(); it != m_CallbackFunctions.end(); ++it)
             {
-                m_CallbackFunctions.erase(counter);
-                trigger -= counter;
+                if ((it->trigger & trigger) && (it->unbound == 0))
+                    it->unbound = m_UnbindCount;
             }
 
-            counter /= 2;
+            for (auto it = m_DeferredCallbackFunctions.begin(); it != m_DeferredCallbackFunctions.end();)
+            {
+                if (it->trigger & trigger)
+                    it = m_DeferredCallbackFunctions.erase(it);
+                else
+                    ++it;
+            }
+        }
+        else
+        {
+            for (auto it = m_CallbackFunctions.begin(); it != m_CallbackFunctions.end();)
+            {
+                if (it->trigger & trigger)
+                    it = m_CallbackFunctions.erase(it);
+                else
+                    ++it;
+            }
         }
+
+        m_BoundTriggers &= ~trigger;
+        m_CallbackDataTriggers &= ~trigger;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void CallbackManager::unbindAllCallback()
     {
-        m_CallbackFunctions.clear();
+        if (m_SendingCallbacks > 0)
+        {
+            // The functions can't be removed while one of them may be running, they are removed when the callbacks are sent
+            ++m_UnbindCount;
+            for (auto it = m_CallbackFunctions.begin(); it != m_CallbackFunctions.end(); ++it)
+            {
+                if (it->unbound == 0)
+                    it->unbound = m_UnbindCount;
+            }
+
+            m_DeferredCallbackFunctions.clear();
+        }
+        else
+            m_CallbackFunctions.clear();
+
+        m_BoundTriggers = 0;
+        m_CallbackDataTriggers = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CallbackManager::mapCallback(const std::function<void()>& function, unsigned int trigger, bool needsCallbackData)
+    {
+        // Every bit of the trigger gets its own entry
+        for (unsigned int bit = 1; (bit != 0) && (bit <= trigger); bit <<= 1)
+        {
+            if (trigger & bit)
+            {
+                CallbackFunction callbackFunction;
+                callbackFunction.trigger = bit;
+                callbackFunction.function = function;
+                callbackFunction.unbound = 0;
+
+                // Adding to the list while callbacks are sent could move the function that is running
+                if (m_SendingCallbacks > 0)
+                    m_DeferredCallbackFunctions.push_back(callbackFunction);
+                else
+                    m_CallbackFunctions.push_back(callbackFunction);
+
+                m_BoundTriggers |= bit;
+                if (needsCallbackData)
+                    m_CallbackDataTriggers |= bit;
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CallbackManager::mapCallback(const std::function<void()>& function, unsigned int trigger)
+    bool CallbackManager::isOnlyBoundToParent(unsigned int trigger) const
     {
-        unsigned int counter = 1;
-        while (counter * 2 <= trigger)
-            counter *= 2;
+        if ((m_BoundTriggers & trigger) == 0)
+            return false;
 
-        while (counter > 0)
+        unsigned int count = 0;
+        for (auto it = m_CallbackFunctions.cbegin(); it != m_CallbackFunctions.cend(); ++it)
         {
-            if (trigger >= counter)
+            if ((it->trigger == trigger) && (it->unbound == 0))
             {
-                m_CallbackFunctions[counter].push_back(function);
-                trigger -= counter;
+                if ((it->function != nullptr) || (++count > 1))
+                    return false;
             }
+        }
 
-            counter /= 2;
+        for (auto it = m_DeferredCallbackFunctions.cbegin(); it != m_DeferredCallbackFunctions.cend(); ++it)
+        {
+            if (it->trigger == trigger)
+            {
+                if ((it->function != nullptr) || (++count > 1))
+                    return false;
+            }
+        }
+
+        return count == 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CallbackManager::applyDeferredBindings()
+    {
+        if (m_UnbindCount > 0)
+        {
+            for (auto it = m_CallbackFunctions.begin(); it != m_CallbackFunctions.end();)
+            {
+                if (it->unbound != 0)
+                    it = m_CallbackFunctions.erase(it);
+                else
+                    ++it;
+            }
+
+            m_UnbindCount = 0;
+        }
+
+        if (!m_DeferredCallbackFunctions.empty())
+        {
+            m_CallbackFunctions.insert(m_CallbackFunctions.end(), m_DeferredCallbackFunctions.begin(), m_DeferredCallbackFunctions.end());
+            m_DeferredCallbackFunctions.clear();
         }
     }
 
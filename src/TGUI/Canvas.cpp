@@ -95,6 +95,8 @@ namespace tgui
 
         m_renderTexture.clear();
         m_renderTexture.display();
+
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,6 +111,7 @@ namespace tgui
     void Canvas::clear(const sf::Color& color)
     {
         m_renderTexture.clear(color);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,13 +133,14 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_sprite, states);
+        RenderBatch::draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
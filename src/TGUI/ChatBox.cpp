@@ -134,6 +134,8 @@ namespace tgui
 
     bool ChatBox::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -154,10 +156,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("ChatBox", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("ChatBox");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -173,10 +174,10 @@ namespace tgui
             configFileFolder = configFileFilename.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "backgroundcolor")
             {
@@ -189,12 +190,12 @@ namespace tgui
             else if (property == "borders")
             {
                 Borders borders;
-                if (extractBorders(value, borders))
+                if (configFile.readBorders(value, borders))
                     setBorders(borders.left, borders.top, borders.right, borders.bottom);
             }
             else if (property == "scrollbar")
             {
-                if ((value.length() < 3) || (value[0] != '"') || (value[value.length()-1] != '"'))
+                if ((value.string.length() < 3) || (value.string[0] != '"') || (value.string[value.string.length()-1] != '"'))
                 {
                     TGUI_OUTPUT("TGUI error: Failed to parse value for Scrollbar in section ChatBox in " + m_LoadedConfigFile + ".");
                     return false;
@@ -202,7 +203,7 @@ namespace tgui
 
                 // load the scrollbar and check if it failed
                 m_Scroll = new Scrollbar();
-                if (m_Scroll->load(configFileFolder + value.substr(1, value.length()-2)) == false)
+                if (m_Scroll->load(configFileFolder + value.string.substr(1, value.string.length()-2)) == false)
                 {
                     // The scrollbar couldn't be loaded so it must be deleted
                     delete m_Scroll;
@@ -237,6 +238,8 @@ namespace tgui
 
     void ChatBox::setSize(float width, float height)
     {
+        appearanceChanged();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -293,6 +296,7 @@ namespace tgui
     void ChatBox::addLine(const sf::String& text)
     {
         addLine(text, m_TextColor, m_TextSize);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -300,6 +304,7 @@ namespace tgui
     void ChatBox::addLine(const sf::String& text, const sf::Color& color)
     {
         addLine(text, color, m_TextSize);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,16 +312,15 @@ namespace tgui
     void ChatBox::addLine(const sf::String& text, unsigned int textSize)
     {
         addLine(text, m_TextColor, textSize);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const sf::Font* font)
     {
-        auto& widgets = m_Panel->getWidgets();
-
         // Remove the top line if you exceed the maximum
-        if ((m_MaxLines > 0) && (m_MaxLines < widgets.size() + 1))
+        if ((m_MaxLines > 0) && (m_MaxLines < m_Panel->getWidgets().size() + 1))
             removeLine(0);
 
         Label::Ptr label(*m_Panel);
@@ -354,7 +358,7 @@ namespace tgui
         }
         label->setText(label->getText() + tempLine->getText());
 
-        m_FullTextHeight += getLineSpacing(widgets.size()-1);
+        m_FullTextHeight += getLineSpacing(m_Panel->getWidgets().size()-1);
 
         if (m_Scroll != nullptr)
         {
@@ -366,6 +370,8 @@ namespace tgui
 
         // Reposition the labels
         updateDisplayedText();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -384,6 +390,8 @@ namespace tgui
 
     bool ChatBox::removeLine(unsigned int lineIndex)
     {
+        appearanceChanged();
+
         if (lineIndex < m_Panel->getWidgets().size())
         {
             tgui::Label::Ptr label = m_Panel->getWidgets()[lineIndex];
@@ -412,6 +420,8 @@ namespace tgui
             m_Scroll->setMaximum(static_cast<unsigned int>(m_FullTextHeight));
 
         updateDisplayedText();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -440,6 +450,8 @@ namespace tgui
 
             updateDisplayedText();
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -466,6 +478,8 @@ namespace tgui
 
         // Reposition the labels
         updateDisplayedText();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -485,6 +499,8 @@ namespace tgui
         // There is a minimum text size
         if (m_TextSize < 8)
             m_TextSize = 8;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -499,6 +515,7 @@ namespace tgui
     void ChatBox::setTextColor(const sf::Color& color)
     {
         m_TextColor = color;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -516,6 +533,8 @@ namespace tgui
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
         m_BottomBorder = bottomBorder;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -523,6 +542,7 @@ namespace tgui
     void ChatBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_Panel->setBackgroundColor(backgroundColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -530,6 +550,7 @@ namespace tgui
     void ChatBox::setBorderColor(const sf::Color& borderColor)
     {
         m_BorderColor = borderColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -553,6 +574,8 @@ namespace tgui
         m_LineSpacing = lineSpacing;
 
         updateDisplayedText();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -562,12 +585,16 @@ namespace tgui
         m_LinesStartFromBottom = startFromBottom;
 
         updateDisplayedText();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ChatBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        appearanceChanged();
+
         // Do nothing when the string is empty
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
@@ -605,6 +632,8 @@ namespace tgui
         // Delete the scrollbar
         delete m_Scroll;
         m_Scroll = nullptr;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -752,6 +781,8 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            const bool scrollHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + m_Panel->getSize().x - m_Scroll->getSize().x, getPosition().y);
 
@@ -777,6 +808,10 @@ namespace tgui
 
             // Reset the position
             m_Scroll->setPosition(0, 0);
+
+            // The scrollbar is not a child widget, so it can't tell itself that its hover state changed
+            if (m_Scroll->m_MouseHover != scrollHover)
+                appearanceChanged();
         }
     }
 
@@ -1047,22 +1082,22 @@ namespace tgui
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), m_Panel->getSize().y + m_TopBorder));
         border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
         border.setFillColor(m_BorderColor);
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(m_Panel->getSize().x + m_RightBorder, static_cast<float>(m_TopBorder)));
         border.setPosition(0, -static_cast<float>(m_TopBorder));
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw right border
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), m_Panel->getSize().y + m_BottomBorder));
         border.setPosition(m_Panel->getSize().x, 0);
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw bottom border
         border.setSize(sf::Vector2f(m_Panel->getSize().x + m_LeftBorder, static_cast<float>(m_BottomBorder)));
         border.setPosition(-static_cast<float>(m_LeftBorder), m_Panel->getSize().y);
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
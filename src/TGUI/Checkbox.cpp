@@ -50,6 +50,8 @@ namespace tgui
 
     bool Checkbox::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -69,10 +71,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("Checkbox", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("Checkbox");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -88,10 +89,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "textcolor")
             {
@@ -149,6 +150,7 @@ namespace tgui
         if (m_TextureFocused.data != nullptr)
         {
             m_AllowFocus = true;
+            focusableChanged();
             m_WidgetPhase |= WidgetPhase_Focused;
         }
         if (m_TextureHover.data != nullptr)
@@ -169,13 +171,15 @@ namespace tgui
             m_Checked = true;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Checked].empty() == false)
+            if (isCallbackBound(Checked))
             {
                 m_Callback.trigger = Checked;
                 m_Callback.checked = true;
                 addCallback();
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,13 +191,15 @@ namespace tgui
             m_Checked = false;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Unchecked].empty() == false)
+            if (isCallbackBound(Unchecked))
             {
                 m_Callback.trigger = Unchecked;
                 m_Callback.checked = false;
                 addCallback();
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -201,7 +207,7 @@ namespace tgui
     void Checkbox::leftMouseReleased(float x, float y)
     {
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMouseReleased].empty() == false)
+        if (isCallbackBound(LeftMouseReleased))
         {
             m_Callback.trigger = LeftMouseReleased;
             m_Callback.checked = m_Checked;
@@ -220,7 +226,7 @@ namespace tgui
                 check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[LeftMouseClicked].empty() == false)
+            if (isCallbackBound(LeftMouseClicked))
             {
                 m_Callback.trigger = LeftMouseClicked;
                 m_Callback.checked = m_Checked;
@@ -247,7 +253,7 @@ namespace tgui
                 check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[SpaceKeyPressed].empty() == false)
+            if (isCallbackBound(SpaceKeyPressed))
             {
                 m_Callback.trigger = SpaceKeyPressed;
                 m_Callback.checked = m_Checked;
@@ -263,7 +269,7 @@ namespace tgui
                 check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ReturnKeyPressed].empty() == false)
+            if (isCallbackBound(ReturnKeyPressed))
             {
                 m_Callback.trigger = ReturnKeyPressed;
                 m_Callback.checked = m_Checked;
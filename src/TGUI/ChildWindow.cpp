@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Button.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/ChildWindow.hpp>
@@ -156,6 +154,8 @@ namespace tgui
 
     bool ChildWindow::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // Until the loading succeeds, the child window will be marked as unloaded
@@ -177,10 +177,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("ChildWindow", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("ChildWindow");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -196,10 +195,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "backgroundcolor")
             {
@@ -280,12 +279,12 @@ namespace tgui
             else if (property == "borders")
             {
                 Borders borders;
-                if (extractBorders(value, borders))
+                if (configFile.readBorders(value, borders))
                     setBorders(borders.left, borders.top, borders.right, borders.bottom);
             }
             else if (property == "distancetoside")
             {
-                setDistanceToSide(static_cast<unsigned int>(atoi(value.c_str())));
+                setDistanceToSide(static_cast<unsigned int>(atoi(value.string.c_str())));
             }
             else
                 TGUI_OUTPUT("TGUI warning: Unrecognized property '" + property + "' in section ChildWindow in " + m_LoadedConfigFile + ".");
@@ -326,7 +325,7 @@ namespace tgui
                 m_Loaded = true;
                 setSize(width, width * 3.0f / 4.0f);
 
-                m_TextureTitleBar_M.data->texture.setRepeated(true);
+                m_TextureTitleBar_M.setRepeated(true);
             }
             else
             {
@@ -389,7 +388,7 @@ namespace tgui
             m_TextureTitleBar_M.sprite.setScale(scalingY, scalingY);
             m_TextureTitleBar_R.sprite.setScale(scalingY, scalingY);
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
@@ -400,6 +399,8 @@ namespace tgui
         // If there is a background texture then resize it
         if (m_BackgroundTexture)
             m_BackgroundSprite.setScale(m_Size.x / m_BackgroundTexture->getSize().x, m_Size.y / m_BackgroundTexture->getSize().y);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -430,6 +431,8 @@ namespace tgui
             m_BackgroundSprite.setTexture(*m_BackgroundTexture, true);
             m_BackgroundSprite.setScale(m_Size.x / m_BackgroundTexture->getSize().x, m_Size.y / m_BackgroundTexture->getSize().y);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -443,6 +446,8 @@ namespace tgui
 
     void ChildWindow::setTitleBarHeight(unsigned int height)
     {
+        appearanceChanged();
+
         // Don't continue when the child window has not been loaded yet
         if (m_Loaded == false)
             return;
@@ -470,7 +475,7 @@ namespace tgui
             m_TextureTitleBar_M.sprite.setScale(scalingY, scalingY);
             m_TextureTitleBar_R.sprite.setScale(scalingY, scalingY);
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
@@ -491,6 +496,7 @@ namespace tgui
     void ChildWindow::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -522,6 +528,7 @@ namespace tgui
     void ChildWindow::setTitle(const sf::String& title)
     {
         m_TitleText.setString(title);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -536,6 +543,7 @@ namespace tgui
     void ChildWindow::setTitleColor(const sf::Color& color)
     {
         m_TitleText.setColor(color);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -550,6 +558,7 @@ namespace tgui
     void ChildWindow::setBorderColor(const sf::Color& borderColor)
     {
         m_BorderColor = borderColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,13 +587,15 @@ namespace tgui
             if (m_Size.x + m_LeftBorder + m_RightBorder < minimumWidth)
                 m_Size.x = minimumWidth - m_LeftBorder - m_RightBorder;
 
-            m_TextureTitleBar_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
+            m_TextureTitleBar_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(((m_Size.x + m_LeftBorder + m_RightBorder) - minimumWidth) / scalingY), m_TextureTitleBar_M.getSize().y));
         }
         else // The image is not split
         {
             m_TextureTitleBar_M.sprite.setScale((m_Size.x + m_LeftBorder + m_RightBorder) / m_TextureTitleBar_M.getSize().x,
                                                 static_cast<float>(m_TitleBarHeight) / m_TextureTitleBar_M.getSize().y);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,6 +603,7 @@ namespace tgui
     void ChildWindow::setDistanceToSide(unsigned int distanceToSide)
     {
         m_DistanceToSide = distanceToSide;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -606,6 +618,7 @@ namespace tgui
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
         m_TitleAlignment = alignment;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -631,6 +644,8 @@ namespace tgui
         }
         else // Loading failed
             TGUI_OUTPUT("Failed to load \"" + filename + "\" as icon for the ChildWindow");
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -639,13 +654,16 @@ namespace tgui
     {
         if (m_IconTexture.data)
             TGUI_TextureManager.removeTexture(m_IconTexture);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChildWindow::destroy()
     {
-        m_Parent->remove(this);
+        if (m_Parent)
+            m_Parent->remove(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -673,7 +691,8 @@ namespace tgui
 
     void ChildWindow::setPosition(float x, float y)
     {
-        if (m_KeepInParent)
+        // A child window that was removed from its parent has nothing to stay inside of
+        if (m_KeepInParent && m_Parent)
         {
             if (y < 0)
                 Transformable::setPosition(getPosition().x, 0);
@@ -704,8 +723,7 @@ namespace tgui
         // Check if the mouse is on top of the title bar
         if (getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, static_cast<float>(m_TitleBarHeight))).contains(x, y))
         {
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            setHoveredWidget(nullptr);
 
             return true;
         }
@@ -720,9 +738,8 @@ namespace tgui
                 {
                     mouseLeftWidget();
 
-                    // Tell the widgets inside the child window that the mouse is no longer on top of them
-                    for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                        m_Widgets[i]->mouseNotOnWidget();
+                    // Tell the widget below the mouse that the mouse is no longer on top of it
+                    setHoveredWidget(nullptr);
 
                     m_CloseButton->mouseNotOnWidget();
                     m_MouseHover = false;
@@ -740,10 +757,11 @@ namespace tgui
         m_MouseDown = true;
 
         // Move the childwindow to the front
-        m_Parent->moveWidgetToFront(this);
+        if (m_Parent)
+            m_Parent->moveWidgetToFront(this);
 
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMousePressed].empty() == false)
+        if (isCallbackBound(LeftMousePressed))
         {
             m_Callback.trigger = LeftMousePressed;
             m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -762,7 +780,10 @@ namespace tgui
 
             // Send the mouse press event to the close button
             if (m_CloseButton->mouseOnWidget(x, y))
+            {
                 m_CloseButton->leftMousePressed(x, y);
+                appearanceChanged();
+            }
             else
             {
                 // The mouse went down on the title bar
@@ -781,7 +802,10 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
                 m_CloseButton->mouseNotOnWidget();
+                appearanceChanged();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
@@ -815,12 +839,13 @@ namespace tgui
             if (m_CloseButton->m_MouseDown == true)
             {
                 m_CloseButton->m_MouseDown = false;
+                appearanceChanged();
 
                 // Check if the mouse is still on the close button
                 if (m_CloseButton->mouseOnWidget(x, y))
                 {
                     // If a callback was requested then send it
-                    if (m_CallbackFunctions[Closed].empty() == false)
+                    if (isCallbackBound(Closed))
                     {
                         m_Callback.trigger = Closed;
                         addCallback();
@@ -834,8 +859,12 @@ namespace tgui
             }
 
             // Tell the widgets that the mouse is no longer down
+            updateWidgetList();
             for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNoLongerDown();
+            {
+                if (m_Widgets[i] != nullptr)
+                    mouseNoLongerDownOnWidget(*m_Widgets[i]);
+            }
 
             // Reset the position of the button
             m_CloseButton->setPosition(0, 0);
@@ -845,17 +874,28 @@ namespace tgui
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
                 m_CloseButton->mouseNotOnWidget();
+                appearanceChanged();
+            }
 
-            m_CloseButton->mouseNoLongerDown();
+            if (m_CloseButton->m_MouseDown)
+            {
+                m_CloseButton->mouseNoLongerDown();
+                appearanceChanged();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
             &&  (getTransform().transformRect(sf::FloatRect(static_cast<float>(m_LeftBorder), static_cast<float>(m_TitleBarHeight + m_TopBorder), m_Size.x, m_Size.y)).contains(x, y) == false))
             {
                 // Tell the widgets about that the mouse was released
+                updateWidgetList();
                 for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                    m_Widgets[i]->mouseNoLongerDown();
+                {
+                    if (m_Widgets[i] != nullptr)
+                        mouseNoLongerDownOnWidget(*m_Widgets[i]);
+                }
 
                 // Don't send the event to the widgets
                 return;
@@ -879,7 +919,7 @@ namespace tgui
             setPosition(position.x + (x - position.x - m_DraggingPosition.x), position.y + (y - position.y - m_DraggingPosition.y));
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Moved].empty() == false)
+            if (isCallbackBound(Moved))
             {
                 m_Callback.trigger = Moved;
                 m_Callback.position = getPosition();
@@ -897,18 +937,27 @@ namespace tgui
             m_CloseButton->setPosition(position.x + ((m_Size.x + m_LeftBorder + m_RightBorder - m_DistanceToSide - m_CloseButton->getSize().x)), position.y + ((m_TitleBarHeight / 2.f) - (m_CloseButton->getSize().x / 2.f)));
 
             // Send the hover event to the close button
+            const bool closeButtonHover = m_CloseButton->m_MouseHover;
             if (m_CloseButton->mouseOnWidget(x, y))
                 m_CloseButton->mouseMoved(x, y);
 
             // Reset the position of the button
             m_CloseButton->setPosition(0, 0);
+
+            // The close button is not a child widget, so it can't tell itself that its hover state changed
+            if (m_CloseButton->m_MouseHover != closeButtonHover)
+                appearanceChanged();
+
             return;
         }
         else // The mouse is not on top of the title bar
         {
             // When the mouse is not on the title bar, the mouse can't be on the close button
             if (m_CloseButton->m_MouseHover)
+            {
                 m_CloseButton->mouseNotOnWidget();
+                appearanceChanged();
+            }
 
             // Check if the mouse is on top of the borders
             if ((getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x + m_LeftBorder + m_RightBorder, m_Size.y + m_TopBorder + m_BottomBorder + m_TitleBarHeight)).contains(x, y))
@@ -934,7 +983,12 @@ namespace tgui
     void ChildWindow::mouseNoLongerDown()
     {
         Container::mouseNoLongerDown();
-        m_CloseButton->mouseNoLongerDown();
+
+        if (m_CloseButton->m_MouseDown)
+        {
+            m_CloseButton->mouseNoLongerDown();
+            appearanceChanged();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1052,11 +1106,11 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+            if (isOnlyBoundToParent(LeftMousePressed))
                 callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(Closed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Closed).size() == 1) && (m_CallbackFunctions.at(Closed).front() == nullptr))
+            if (isOnlyBoundToParent(Closed))
                 callbacks.push_back("Closed");
-            if ((m_CallbackFunctions.find(Moved) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Moved).size() == 1) && (m_CallbackFunctions.at(Moved).front() == nullptr))
+            if (isOnlyBoundToParent(Moved))
                 callbacks.push_back("Moved");
 
             encodeList(callbacks, value);
@@ -1101,35 +1155,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    bool ChildWindow::updateRenderCaches()
     {
-        // Don't draw when the child window wasn't created
-        if (m_Loaded == false)
-            return;
+        bool rendered = Container::updateRenderCaches();
 
-        // Calculate the scale factor of the view
-        const sf::View& view = target.getView();
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
+        if (!m_RenderCacheEnabled || m_RenderCacheValid || (m_Loaded == false))
+            return rendered;
 
-        // Get the global position
-        sf::Vector2f topLeftPanelPosition = sf::Vector2f(((getAbsolutePosition().x + m_LeftBorder - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                         ((getAbsolutePosition().y + m_TitleBarHeight + m_TopBorder - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPanelPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x + m_LeftBorder - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                             (getAbsolutePosition().y + m_TitleBarHeight + m_Size.y + m_TopBorder - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
+        sf::Vector2f position = getAbsolutePosition() + getWidgetsOffset();
 
-        sf::Vector2f topLeftTitleBarPosition;
-        sf::Vector2f bottomRightTitleBarPosition;
+        sf::RenderTarget* target = beginRenderCache(position, m_Size);
+        if (target == nullptr)
+            return rendered;
 
-        if (m_IconTexture.data)
-            topLeftTitleBarPosition = sf::Vector2f(((getAbsolutePosition().x + 2*m_DistanceToSide + m_IconTexture.getSize().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                   ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        else
-            topLeftTitleBarPosition = sf::Vector2f(((getAbsolutePosition().x + m_DistanceToSide - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                   ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
+        sf::RenderStates states;
+        states.transform.translate(position);
+
+        if (m_BackgroundColor != sf::Color::Transparent)
+        {
+            sf::RectangleShape background(sf::Vector2f(m_Size.x, m_Size.y));
+            background.setFillColor(m_BackgroundColor);
+            target->draw(background, states);
+        }
+
+        if (m_BackgroundTexture != nullptr)
+            target->draw(m_BackgroundSprite, states);
+
+        // The texture has its own clipping area, which is unrelated to the one of the gui
+        ClipStack clipStack;
+        clipStack.begin(*target);
+        drawWidgetContainer(target, states);
+        clipStack.end();
+
+        endRenderCache();
+        return true;
+    }
 
-        bottomRightTitleBarPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x + m_LeftBorder + m_RightBorder - (2*m_DistanceToSide) - m_CloseButton->getSize().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                   (getAbsolutePosition().y + m_TitleBarHeight - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChildWindow::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        // Don't draw when the child window wasn't created
+        if (m_Loaded == false)
+            return;
 
         // Adjust the transformation
         states.transform *= getTransform();
@@ -1139,19 +1207,19 @@ namespace tgui
         // Check if the title bar image is split
         if (m_SplitImage)
         {
-            target.draw(m_TextureTitleBar_L, states);
+            RenderBatch::draw(target, m_TextureTitleBar_L, states);
 
             states.transform.translate(m_TextureTitleBar_L.getSize().x * (static_cast<float>(m_TitleBarHeight) / m_TextureTitleBar_M.getSize().y), 0);
-            target.draw(m_TextureTitleBar_M, states);
+            RenderBatch::draw(target, m_TextureTitleBar_M, states);
 
             states.transform.translate(m_Size.x + m_LeftBorder + m_RightBorder - ((m_TextureTitleBar_R.getSize().x + m_TextureTitleBar_L.getSize().x)
                                                                                   * (static_cast<float>(m_TitleBarHeight) / m_TextureTitleBar_M.getSize().y)), 0);
-            target.draw(m_TextureTitleBar_R, states);
+            RenderBatch::draw(target, m_TextureTitleBar_R, states);
         }
         else // The title bar image isn't split
         {
             // Draw the title bar
-            target.draw(m_TextureTitleBar_M, states);
+            RenderBatch::draw(target, m_TextureTitleBar_M, states);
         }
 
         states.transform = oldTransform;
@@ -1160,32 +1228,27 @@ namespace tgui
         if (m_IconTexture.data)
         {
             states.transform.translate(static_cast<float>(m_DistanceToSide), (m_TitleBarHeight - (m_IconTexture.getSize().y * m_IconTexture.sprite.getScale().y)) / 2.f);
-            target.draw(m_IconTexture, states);
+            RenderBatch::draw(target, m_IconTexture, states);
             states.transform.translate(m_IconTexture.getSize().x * m_IconTexture.sprite.getScale().x, (m_TitleBarHeight - (m_IconTexture.getSize().y * m_IconTexture.sprite.getScale().y)) / -2.f);
         }
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
         // Check if there is a title
         if (m_TitleText.getString().isEmpty() == false)
         {
-            // Calculate the clipping area
-            GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftTitleBarPosition.x * scaleViewX), scissor[0]);
-            GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftTitleBarPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-            GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightTitleBarPosition.x * scaleViewX), scissor[0] + scissor[2]);
-            GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightTitleBarPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-            // If the widget outside the window then don't draw anything
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            else if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
+            // The title may not be drawn on top of the icon or the close button
+            sf::FloatRect titleArea(getAbsolutePosition().x + m_DistanceToSide, getAbsolutePosition().y,
+                                    m_Size.x + m_LeftBorder + m_RightBorder - 3*m_DistanceToSide - m_CloseButton->getSize().x, static_cast<float>(m_TitleBarHeight));
+            if (m_IconTexture.data)
+            {
+                titleArea.left += m_DistanceToSide + m_IconTexture.getSize().x;
+                titleArea.width -= m_DistanceToSide + m_IconTexture.getSize().x;
+            }
 
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            // The title is also cut off when the child window is drawn without gui
+            ClipStack clipStack;
+            clipStack.beginIfInactive(target);
 
+            ClipStack::push(target, titleArea);
             // Center the text vertically
             states.transform.translate(0, std::floor(((m_TitleBarHeight - m_TitleText.getLocalBounds().height) / 2.0f) - m_TitleText.getLocalBounds().top));
 
@@ -1193,7 +1256,7 @@ namespace tgui
             if (m_TitleAlignment == TitleAlignmentLeft)
             {
                 states.transform.translate(std::floor(static_cast<float>(m_DistanceToSide) + 0.5f), 0);
-                target.draw(m_TitleText, states);
+                RenderBatch::draw(target, m_TitleText, states);
             }
             else if (m_TitleAlignment == TitleAlignmentCentered)
             {
@@ -1202,7 +1265,7 @@ namespace tgui
                 else
                     states.transform.translate(std::floor(m_DistanceToSide + (((m_Size.x + m_LeftBorder + m_RightBorder) - 3*m_DistanceToSide - m_CloseButton->getSize().x - m_TitleText.getGlobalBounds().width) / 2.0f) + 0.5f), 0);
 
-                target.draw(m_TitleText, states);
+                RenderBatch::draw(target, m_TitleText, states);
             }
             else // if (m_TitleAlignment == TitleAlignmentRight)
             {
@@ -1211,11 +1274,11 @@ namespace tgui
                 else
                     states.transform.translate(std::floor((m_Size.x + m_LeftBorder + m_RightBorder) - 2*m_DistanceToSide - m_CloseButton->getSize().x - m_TitleText.getGlobalBounds().width + 0.5f), 0);
 
-                target.draw(m_TitleText, states);
+                RenderBatch::draw(target, m_TitleText, states);
             }
 
-            // Reset the old clipping area
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            ClipStack::pop(target);
+            clipStack.end();
         }
 
         // Move the close button to the correct position
@@ -1231,57 +1294,56 @@ namespace tgui
         // Draw left border
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), m_Size.y + m_TopBorder));
         border.setFillColor(m_BorderColor);
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(m_Size.x + m_RightBorder, static_cast<float>(m_TopBorder)));
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw right border
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), m_Size.y + m_BottomBorder));
         border.setPosition(m_Size.x + m_LeftBorder, 0);
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw bottom border
         border.setSize(sf::Vector2f(m_Size.x + m_LeftBorder, static_cast<float>(m_BottomBorder)));
         border.setPosition(0, m_Size.y + m_TopBorder);
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Make room for the borders
         states.transform.translate(static_cast<float>(m_LeftBorder), static_cast<float>(m_TopBorder));
 
+        // The background and the widgets may have been cached
+        if (m_RenderCacheEnabled && m_RenderCacheValid)
+        {
+            RenderBatch::draw(target, sf::Sprite(m_RenderCache->getTexture()), states);
+            return;
+        }
+
         // Draw the background
         if (m_BackgroundColor != sf::Color::Transparent)
         {
             sf::RectangleShape background(sf::Vector2f(m_Size.x, m_Size.y));
             background.setFillColor(m_BackgroundColor);
-            target.draw(background, states);
+            RenderBatch::draw(target, background, states);
         }
 
         // Draw the background image if there is one
         if (m_BackgroundTexture != nullptr)
-            target.draw(m_BackgroundSprite, states);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPanelPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPanelPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPanelPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
+            RenderBatch::draw(target, m_BackgroundSprite, states);
 
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        // Drawn without gui, the child window needs its own clip stack for its widgets
+        ClipStack clipStack;
+        clipStack.beginIfInactive(target);
 
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // The widgets can only be drawn inside the borders
+        ClipStack::push(target, sf::FloatRect(getAbsolutePosition().x + m_LeftBorder, getAbsolutePosition().y + m_TitleBarHeight + m_TopBorder, m_Size.x, m_Size.y));
 
         // Draw the widgets in the child window
         drawWidgetContainer(&target, states);
 
-        // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        ClipStack::pop(target);
+        clipStack.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -80,6 +80,7 @@ namespace tgui
     {
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,13 +109,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ClickableWidget::getMouseBounds(sf::FloatRect& bounds) const
+    {
+        bounds = getTransform().transformRect(sf::FloatRect(0, 0, getSize().x, getSize().y));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ClickableWidget::getDrawBounds(sf::FloatRect& bounds) const
+    {
+        bounds = getTransform().transformRect(sf::FloatRect(0, 0, getSize().x, getSize().y));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ClickableWidget::leftMousePressed(float x, float y)
     {
         // Set the mouse down flag
         m_MouseDown = true;
 
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMousePressed].empty() == false)
+        if (isCallbackBound(LeftMousePressed))
         {
             m_Callback.trigger = LeftMousePressed;
             m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -128,7 +145,7 @@ namespace tgui
     void ClickableWidget::leftMouseReleased(float x, float y)
     {
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMouseReleased].empty() == false)
+        if (isCallbackBound(LeftMouseReleased))
         {
             m_Callback.trigger = LeftMouseReleased;
             m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -140,7 +157,7 @@ namespace tgui
         if (m_MouseDown == true)
         {
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[LeftMouseClicked].empty() == false)
+            if (isCallbackBound(LeftMouseClicked))
             {
                 m_Callback.trigger = LeftMouseClicked;
                 m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -195,11 +212,11 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+            if (isOnlyBoundToParent(LeftMousePressed))
                 callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(LeftMouseReleased) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseReleased).size() == 1) && (m_CallbackFunctions.at(LeftMouseReleased).front() == nullptr))
+            if (isOnlyBoundToParent(LeftMouseReleased))
                 callbacks.push_back("LeftMouseReleased");
-            if ((m_CallbackFunctions.find(LeftMouseClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseClicked).size() == 1) && (m_CallbackFunctions.at(LeftMouseClicked).front() == nullptr))
+            if (isOnlyBoundToParent(LeftMouseClicked))
                 callbacks.push_back("LeftMouseClicked");
 
             encodeList(callbacks, value);
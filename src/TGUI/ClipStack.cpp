@@ -0,0 +1,265 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <SFML/OpenGL.hpp>
+
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/ClipStack.hpp>
+#include <TGUI/RecordingTarget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    ClipStack* ClipStack::m_ActiveStack = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ClipStack::ClipStack() :
+        m_Target            (nullptr),
+        m_Recorder          (nullptr),
+        m_PreviousStack     (nullptr),
+        m_EnabledScissorTest(false),
+        m_ScissorChanges    (0),
+        m_DrawnWidgets      (0),
+        m_CulledWidgets     (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::begin(sf::RenderTarget& target)
+    {
+        // Everything on the target is visible at first
+        start(target, sf::IntRect(0, 0, static_cast<int>(target.getSize().x), static_cast<int>(target.getSize().y)), true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::begin(sf::RenderTarget& target, const sf::IntRect& area)
+    {
+        start(target, area, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::beginIfInactive(sf::RenderTarget& target)
+    {
+        if (!isActive(target))
+            begin(target);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::end()
+    {
+        if (m_Target == nullptr)
+            return;
+
+        RenderBatch::flushActive();
+
+        // Only turn off the scissor test when it wasn't enabled before, otherwise the area from before begin is used again
+        if (m_EnabledScissorTest && !m_Recorder)
+            glDisable(GL_SCISSOR_TEST);
+        else if (m_AppliedArea != m_Areas.front())
+            setScissor(m_Areas.front());
+
+        m_ActiveStack = m_PreviousStack;
+        m_PreviousStack = nullptr;
+        m_Target = nullptr;
+        m_Recorder = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ClipStack::isActive(const sf::RenderTarget& target)
+    {
+        return (m_ActiveStack != nullptr) && (m_ActiveStack->m_Target == &target);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ClipStack::getScissorChangeCount() const
+    {
+        return m_ScissorChanges;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ClipStack::getDrawnWidgetCount() const
+    {
+        return m_DrawnWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ClipStack::getCulledWidgetCount() const
+    {
+        return m_CulledWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::push(sf::RenderTarget& target, const sf::FloatRect& area)
+    {
+        if (!isActive(target))
+            return;
+
+        const sf::FloatRect pixels = toPixels(target, area);
+
+        // The new area can't be larger than the current one
+        const sf::IntRect& current = m_ActiveStack->m_Areas.back();
+        int left = TGUI_MAXIMUM(static_cast<int>(pixels.left), current.left);
+        int top = TGUI_MAXIMUM(static_cast<int>(pixels.top), current.top);
+        int right = TGUI_MINIMUM(static_cast<int>(pixels.left + pixels.width), current.left + current.width);
+        int bottom = TGUI_MINIMUM(static_cast<int>(pixels.top + pixels.height), current.top + current.height);
+
+        // Nothing is visible when the area lies outside the current one
+        if (right < left)
+            right = left;
+        if (bottom < top)
+            bottom = top;
+
+        m_ActiveStack->m_Areas.push_back(sf::IntRect(left, top, right - left, bottom - top));
+        m_ActiveStack->apply();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::pop(sf::RenderTarget& target)
+    {
+        if (!isActive(target))
+            return;
+
+        // The area of the whole target is never removed
+        if (m_ActiveStack->m_Areas.size() > 1)
+        {
+            m_ActiveStack->m_Areas.pop_back();
+            m_ActiveStack->apply();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ClipStack::isWidgetVisible(sf::RenderTarget& target, const sf::FloatRect* bounds)
+    {
+        if (!isActive(target))
+            return true;
+
+        // Widgets that don't know where they draw can't be skipped
+        if (bounds == nullptr)
+        {
+            ++m_ActiveStack->m_DrawnWidgets;
+            return true;
+        }
+
+        // The widget is only visible when it overlaps the current area by some part of a pixel
+        const sf::FloatRect pixels = toPixels(target, *bounds);
+        const sf::IntRect& current = m_ActiveStack->m_Areas.back();
+        if ((pixels.left < current.left + current.width) && (pixels.left + pixels.width > current.left)
+         && (pixels.top < current.top + current.height) && (pixels.top + pixels.height > current.top))
+        {
+            ++m_ActiveStack->m_DrawnWidgets;
+            return true;
+        }
+        else
+        {
+            ++m_ActiveStack->m_CulledWidgets;
+            return false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::start(sf::RenderTarget& target, const sf::IntRect& area, bool enableScissorTest)
+    {
+        m_Target = &target;
+        m_Recorder = dynamic_cast<RecordingTarget*>(&target);
+        m_EnabledScissorTest = enableScissorTest;
+        m_ScissorChanges = 0;
+        m_DrawnWidgets = 0;
+        m_CulledWidgets = 0;
+
+        m_PreviousStack = m_ActiveStack;
+        m_ActiveStack = this;
+
+        m_Areas.clear();
+        m_Areas.push_back(area);
+
+        if (enableScissorTest && !m_Recorder)
+            glEnable(GL_SCISSOR_TEST);
+
+        setScissor(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::apply()
+    {
+        const sf::IntRect& area = m_Areas.back();
+        if (area == m_AppliedArea)
+            return;
+
+        // What was collected so far still has to be drawn with the old clipping area
+        RenderBatch::flushActive();
+
+        setScissor(area);
+        ++m_ScissorChanges;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClipStack::setScissor(const sf::IntRect& area)
+    {
+        if (m_Recorder)
+            m_Recorder->setClipArea(area);
+        else // OpenGL places the origin in the bottom left corner
+            glScissor(area.left, static_cast<GLint>(m_Target->getSize().y) - area.top - area.height, area.width, area.height);
+
+        m_AppliedArea = area;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect ClipStack::toPixels(const sf::RenderTarget& target, const sf::FloatRect& area)
+    {
+        // Convert the area in the same way as the view does it (rotated views are not supported)
+        const sf::View& view = target.getView();
+        const float scaleViewX = target.getSize().x / view.getSize().x;
+        const float scaleViewY = target.getSize().y / view.getSize().y;
+
+        const sf::Vector2f topLeft(((area.left - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
+                                   ((area.top - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
+        const sf::Vector2f bottomRight(((area.left + area.width - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
+                                       ((area.top + area.height - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
+
+        return sf::FloatRect(topLeft.x * scaleViewX, topLeft.y * scaleViewY,
+                             (bottomRight.x - topLeft.x) * scaleViewX, (bottomRight.y - topLeft.y) * scaleViewY);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
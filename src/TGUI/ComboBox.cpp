@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/ListBox.hpp>
 #include <TGUI/Container.hpp>
@@ -60,6 +58,7 @@ namespace tgui
     ComboBox::ComboBox(const ComboBox& copy) :
     Widget              (copy),
     WidgetBorders       (copy),
+    onItemSelected      (copy.onItemSelected),
     m_LoadedConfigFile  (copy.m_LoadedConfigFile),
     m_SeparateHoverImage(copy.m_SeparateHoverImage),
     m_NrOfItemsToDisplay(copy.m_NrOfItemsToDisplay),
@@ -96,6 +95,7 @@ namespace tgui
             this->Widget::operator=(right);
             this->WidgetBorders::operator=(right);
 
+            std::swap(onItemSelected,           temp.onItemSelected);
             std::swap(m_LoadedConfigFile,       temp.m_LoadedConfigFile);
             std::swap(m_SeparateHoverImage,     temp.m_SeparateHoverImage);
             std::swap(m_NrOfItemsToDisplay,     temp.m_NrOfItemsToDisplay);
@@ -120,6 +120,8 @@ namespace tgui
 
     bool ComboBox::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -139,10 +141,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("ComboBox", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("ComboBox");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -158,10 +159,10 @@ namespace tgui
             configFileFolder = configFileFilename.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "separatehoverimage")
             {
@@ -190,7 +191,7 @@ namespace tgui
             else if (property == "borders")
             {
                 Borders borders;
-                if (extractBorders(value, borders))
+                if (configFile.readBorders(value, borders))
                     setBorders(borders.left, borders.top, borders.right, borders.bottom);
             }
             else if (property == "arrowupnormalimage")
@@ -227,13 +228,13 @@ namespace tgui
             }
             else if (property == "scrollbar")
             {
-                if ((value.length() < 3) || (value[0] != '"') || (value[value.length()-1] != '"'))
+                if ((value.string.length() < 3) || (value.string[0] != '"') || (value.string[value.string.length()-1] != '"'))
                 {
                     TGUI_OUTPUT("TGUI error: Failed to parse value for Scrollbar in section ComboBox in " + m_LoadedConfigFile + ".");
                     return false;
                 }
 
-                if (!m_ListBox->setScrollbar(configFileFolder + value.substr(1, value.length()-2)))
+                if (!m_ListBox->setScrollbar(configFileFolder + value.string.substr(1, value.string.length()-2)))
                     return false;
             }
             else
@@ -270,6 +271,8 @@ namespace tgui
 
     void ComboBox::setSize(float width, float height)
     {
+        appearanceChanged();
+
         // Don't set the scale when loading failed
         if (m_Loaded == false)
             return;
@@ -314,6 +317,8 @@ namespace tgui
 
         if (m_NrOfItemsToDisplay < m_ListBox->m_Items.size())
             m_ListBox->setSize(m_ListBox->getSize().x, static_cast<float>(m_NrOfItemsToDisplay * m_ListBox->getItemHeight()));
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -330,6 +335,7 @@ namespace tgui
                                 const sf::Color& borderColor)
     {
         m_ListBox->changeColors(backgroundColor, textColor, selectedBackgroundColor, selectedTextColor, borderColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -337,6 +343,7 @@ namespace tgui
     void ComboBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_ListBox->setBackgroundColor(backgroundColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -344,6 +351,7 @@ namespace tgui
     void ComboBox::setTextColor(const sf::Color& textColor)
     {
         m_ListBox->setTextColor(textColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -351,6 +359,7 @@ namespace tgui
     void ComboBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
         m_ListBox->setSelectedBackgroundColor(selectedBackgroundColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -358,6 +367,7 @@ namespace tgui
     void ComboBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
         m_ListBox->setSelectedTextColor(selectedTextColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -365,6 +375,7 @@ namespace tgui
     void ComboBox::setBorderColor(const sf::Color& borderColor)
     {
         m_ListBox->setBorderColor(borderColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -407,6 +418,7 @@ namespace tgui
     void ComboBox::setTextFont(const sf::Font& font)
     {
         m_ListBox->setTextFont(font);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -420,6 +432,8 @@ namespace tgui
 
     void ComboBox::setBorders(unsigned int leftBorder, unsigned int topBorder, unsigned int rightBorder, unsigned int bottomBorder)
     {
+        appearanceChanged();
+
         // Set the new border size
         m_LeftBorder   = leftBorder;
         m_TopBorder    = topBorder;
@@ -440,6 +454,8 @@ namespace tgui
 
     int ComboBox::addItem(const sf::String& item, int id)
     {
+        appearanceChanged();
+
         // An item can only be added when the combo box was loaded correctly
         if (m_Loaded == false)
             return false;
@@ -456,6 +472,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
+        appearanceChanged();
+
         return m_ListBox->setSelectedItem(itemName);
     }
 
@@ -463,6 +481,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(int index)
     {
+        appearanceChanged();
+
         return m_ListBox->setSelectedItem(index);
     }
 
@@ -471,12 +491,15 @@ namespace tgui
     void ComboBox::deselectItem()
     {
         m_ListBox->deselectItem();
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::removeItem(unsigned int index)
     {
+        appearanceChanged();
+
         bool ret = m_ListBox->removeItem(index);
 
         // Shrink the list size
@@ -490,6 +513,8 @@ namespace tgui
 
     bool ComboBox::removeItem(const sf::String& itemName)
     {
+        appearanceChanged();
+
         bool ret = m_ListBox->removeItem(itemName);
 
         // Shrink the list size
@@ -503,6 +528,8 @@ namespace tgui
 
     unsigned int ComboBox::removeItemsById(int id)
     {
+        appearanceChanged();
+
         unsigned int ret = m_ListBox->removeItemsById(id);
 
         // Shrink the list size
@@ -518,6 +545,8 @@ namespace tgui
     {
         m_ListBox->removeAllItems();
         m_ListBox->setSize(m_ListBox->getSize().x, m_ListBox->getItemHeight());
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -566,6 +595,8 @@ namespace tgui
 
     bool ComboBox::changeItem(unsigned int index, const sf::String& newValue)
     {
+        appearanceChanged();
+
         return m_ListBox->changeItem(index, newValue);
     }
 
@@ -573,6 +604,8 @@ namespace tgui
 
     unsigned int ComboBox::changeItems(const sf::String& originalValue, const sf::String& newValue)
     {
+        appearanceChanged();
+
         return m_ListBox->changeItems(originalValue, newValue);
     }
 
@@ -580,6 +613,8 @@ namespace tgui
 
     unsigned int ComboBox::changeItemsById(int id, const sf::String& newValue)
     {
+        appearanceChanged();
+
         return m_ListBox->changeItemsById(id, newValue);
     }
 
@@ -587,6 +622,8 @@ namespace tgui
 
     bool ComboBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        appearanceChanged();
+
         return m_ListBox->setScrollbar(scrollbarConfigFileFilename);
     }
 
@@ -595,6 +632,7 @@ namespace tgui
     void ComboBox::removeScrollbar()
     {
         m_ListBox->removeScrollbar();
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -602,6 +640,7 @@ namespace tgui
     void ComboBox::setMaximumItems(unsigned int maximumItems)
     {
         m_ListBox->setMaximumItems(maximumItems);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -834,7 +873,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ItemSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ItemSelected).size() == 1) && (m_CallbackFunctions.at(ItemSelected).front() == nullptr))
+            if (isOnlyBoundToParent(ItemSelected))
                 callbacks.push_back("ItemSelected");
 
             encodeList(callbacks, value);
@@ -931,10 +970,15 @@ namespace tgui
 
     void ComboBox::newItemSelectedCallbackFunction()
     {
-        if (m_CallbackFunctions[ItemSelected].empty() == false)
+        // When no item is selected then send an empty string, otherwise send the item
+        if (!onItemSelected.isEmpty())
+            onItemSelected(m_ListBox->getSelectedItem(), m_ListBox->getSelectedItemIndex());
+
+        if (isCallbackBound(ItemSelected))
         {
-            // When no item is selected then send an empty string, otherwise send the item
-            m_Callback.text    = m_ListBox->getSelectedItem();
+            if (isCallbackDataNeeded(ItemSelected))
+                m_Callback.text = m_ListBox->getSelectedItem();
+
             m_Callback.value   = m_ListBox->getSelectedItemIndex();
             m_Callback.trigger = ItemSelected;
             addCallback();
@@ -959,19 +1003,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + (m_ListBox->getSize().x - (m_TextureArrowDownNormal.getSize().x * (static_cast<float>(m_ListBox->getItemHeight()) / m_TextureArrowDownNormal.getSize().y)))
-                                                         - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + m_ListBox->getSize().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -982,60 +1013,50 @@ namespace tgui
         sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_ListBox->getItemHeight() + m_TopBorder)));
         border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
         border.setFillColor(m_ListBox->m_BorderColor);
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw top border
         border.setSize(sf::Vector2f(static_cast<float>(m_ListBox->getSize().x + m_RightBorder), static_cast<float>(m_TopBorder)));
         border.setPosition(0, -static_cast<float>(m_TopBorder));
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw right border
         border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_ListBox->getItemHeight() + m_BottomBorder)));
         border.setPosition(static_cast<float>(m_ListBox->getSize().x), 0);
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw bottom border
         border.setSize(sf::Vector2f(m_ListBox->getSize().x + m_LeftBorder, static_cast<float>(m_BottomBorder)));
         border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_ListBox->getItemHeight()));
-        target.draw(border, states);
+        RenderBatch::draw(target, border, states);
 
         // Draw the combo box
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_ListBox->getSize().x),
                                               static_cast<float>(m_ListBox->getItemHeight())));
         front.setFillColor(m_ListBox->getBackgroundColor());
-        target.draw(front, states);
+        RenderBatch::draw(target, front, states);
 
         // Create a text widget to draw it
         sf::Text tempText("kg", *m_ListBox->getTextFont());
         tempText.setCharacterSize(static_cast<unsigned int>(m_ListBox->getItemHeight() * 0.8f));
         tempText.setColor(m_ListBox->getTextColor());
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x  * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        // The text may not be drawn on top of the arrow
+        const float arrowWidth = m_TextureArrowDownNormal.getSize().x * (static_cast<float>(m_ListBox->getItemHeight()) / m_TextureArrowDownNormal.getSize().y);
+        // Drawn without gui, the combo box needs its own clip stack
+        ClipStack clipStack;
+        clipStack.beginIfInactive(target);
 
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        ClipStack::push(target, sf::FloatRect(getAbsolutePosition(), sf::Vector2f(m_ListBox->getSize().x - arrowWidth, m_ListBox->getSize().y)));
 
         // Draw the selected item
         states.transform.translate(2, std::floor((static_cast<int>(m_ListBox->getItemHeight()) - tempText.getLocalBounds().height) / 2.0f -  tempText.getLocalBounds().top));
         tempText.setString(m_ListBox->getSelectedItem());
-        target.draw(tempText, states);
+        RenderBatch::draw(target, tempText, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        ClipStack::pop(target);
+        clipStack.end();
 
         // Reset the transformations
         states.transform = oldTransform;
@@ -1051,16 +1072,16 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowUpNormal, states);
             }
             else // There is no separate hover image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                RenderBatch::draw(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowUpHover, states);
+                    RenderBatch::draw(target, m_TextureArrowUpHover, states);
             }
         }
         else
@@ -1073,16 +1094,16 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowDownHover, states);
+                    RenderBatch::draw(target, m_TextureArrowDownHover, states);
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowDownNormal, states);
             }
             else // There is no separate hover image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                RenderBatch::draw(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureArrowDownHover, states);
+                    RenderBatch::draw(target, m_TextureArrowDownHover, states);
             }
         }
     }
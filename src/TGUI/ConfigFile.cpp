@@ -33,7 +33,27 @@
 
 namespace tgui
 {
-    std::map<std::string, std::map<std::string, std::pair<std::vector<std::string>, std::vector<std::string>>>> ConfigFile::m_Cache;
+    std::map<std::string, std::map<std::string, ConfigSection>> ConfigFile::m_Cache;
+    sf::Mutex ConfigFile::m_CacheMutex;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ConfigValue::ConfigValue() :
+    isBool   (false),
+    boolValue(false),
+    color    (sf::Color::Black),
+    isBorders(false),
+    isTexture(false)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ConfigFile::ConfigFile() :
+    m_CachedFile(nullptr)
+    {
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,8 +71,15 @@ namespace tgui
         m_Filename = filename;
 
         // The file may be cached
-        if (m_Cache.find(filename) != m_Cache.end())
+        sf::Lock lock(m_CacheMutex);
+        auto fileIt = m_Cache.find(filename);
+        if (fileIt != m_Cache.end())
+        {
+            m_CachedFile = &fileIt->second;
             return true;
+        }
+        else
+            m_CachedFile = nullptr;
 
         // If a file is already open then close it
         if (m_File.is_open())
@@ -70,28 +97,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ConfigFile::read(const std::string& section, std::vector<std::string>& properties, std::vector<std::string>& values)
+    const ConfigSection* ConfigFile::read(const std::string& section)
     {
-        // Only parse the file once
-        if (m_Cache.find(m_Filename) == m_Cache.end())
+        sf::Lock lock(m_CacheMutex);
+
+        // Only parse the file once (another thread may have parsed it since it was opened)
+        if (m_CachedFile == nullptr)
         {
-            m_Cache[m_Filename] = std::map<std::string, std::pair<std::vector<std::string>, std::vector<std::string>>>();
-            if (!readAndCache())
-                return false;
+            auto fileIt = m_Cache.find(m_Filename);
+            if (fileIt != m_Cache.end())
+                m_CachedFile = &fileIt->second;
+            else
+            {
+                m_CachedFile = &m_Cache[m_Filename];
+                if (!readAndCache())
+                    return nullptr;
+
+                // Pack all images that are used in this config file together, before the widgets start loading them
+                addRepeatedParts(m_Filename, *m_CachedFile);
+                TGUI_TextureManager.buildAtlas(readImageFilenames());
+            }
         }
 
         // Output an error when the section wasn't found
-        std::string lowercaseSection = toLower(section);
-        if (m_Cache[m_Filename].find(lowercaseSection) == m_Cache[m_Filename].end())
+        auto sectionIt = m_CachedFile->find(toLower(section));
+        if (sectionIt == m_CachedFile->end())
         {
             TGUI_OUTPUT("TGUI error: Section '" + section + "' was not found in the config file '" + m_Filename + "'.");
-            return false;
+            return nullptr;
         }
 
-        // Fill in properties and values
-        properties = m_Cache[m_Filename][lowercaseSection].first;
-        values = m_Cache[m_Filename][lowercaseSection].second;
-        return true;
+        return &sectionIt->second;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,9 +144,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    sf::Color ConfigFile::readColor(const std::string& value) const
+    bool ConfigFile::readBool(const ConfigValue& value, bool defaultValue) const
+    {
+        if (value.isBool)
+            return value.boolValue;
+        else
+            return defaultValue;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& ConfigFile::readColor(const ConfigValue& value) const
+    {
+        return value.color;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ConfigFile::readBorders(const ConfigValue& value, Borders& borders) const
     {
-        return extractColor(value);
+        if (value.isBorders)
+            borders = value.borders;
+
+        return value.isBorders;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -166,54 +222,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ConfigFile::readTexture(const std::string& value, const std::string& rootPath, Texture& texture) const
+    bool ConfigFile::readTexture(const ConfigValue& value, const std::string& rootPath, Texture& texture) const
     {
-        std::string::const_iterator c = value.begin();
-
-        // Remove all whitespaces (string should still contains something)
-        if (!removeWhitespace(value, c))
-            return false;
-
-        // There has to be a quote
-        if (*c == '"')
-            ++c;
-        else
-            return false;
-
-        std::string filename;
-        char prev = '\0';
-
-        // Look for the end quote
-        bool filenameFound = false;
-        while (c != value.end())
-        {
-            if ((*c != '"') || (prev == '\\'))
-            {
-                prev = *c;
-                filename.push_back(*c);
-                ++c;
-            }
-            else
-            {
-                ++c;
-                filenameFound = true;
-                break;
-            }
-        }
-
-        if (!filenameFound)
+        if (!value.isTexture)
             return false;
 
-        // There may be an optional parameter
-        sf::IntRect rect;
-        if (removeWhitespace(value, c))
-        {
-            if (!readIntRect(value.substr(c - value.begin(), value.length() - (c - value.begin())), rect))
-                return false;
-        }
-
-        // Load the texture
-        return TGUI_TextureManager.getTexture(rootPath + filename, texture, rect);
+        // The texture manager already shares the image between all widgets that use it. The cache doesn't hold on to the
+        // texture itself, so that the image is released as soon as the last widget that uses it is destroyed. It only
+        // remembers the image, so that loading the next widget doesn't have to search for the image again.
+        return TGUI_TextureManager.getTexture(value.cachedImage, rootPath, value.filename, texture, value.textureRect);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -229,7 +246,12 @@ namespace tgui
 
     void ConfigFile::flushCache()
     {
+        sf::Lock lock(m_CacheMutex);
+
         m_Cache.clear();
+
+        // The images that were packed when the files were opened are no longer needed when no widget uses them
+        TGUI_TextureManager.removeUnusedImages();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -293,8 +315,11 @@ namespace tgui
                     int pos = c - line.begin();
                     value = line.substr(pos, line.length() - pos);
 
-                    m_Cache[m_Filename][sectionName].first.push_back(property);
-                    m_Cache[m_Filename][sectionName].second.push_back(value);
+                    ConfigSection& section = (*m_CachedFile)[sectionName];
+                    section.properties.push_back(property);
+                    section.values.push_back(ConfigValue());
+                    section.values.back().string = value;
+                    parseValue(section.values.back());
                 }
 
                 error |= lineError;
@@ -306,6 +331,110 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ConfigFile::parseValue(ConfigValue& value) const
+    {
+        value.isBool = (readBool(value.string, false) == readBool(value.string, true));
+        value.boolValue = readBool(value.string, false);
+
+        value.color = extractColor(value.string);
+        value.isBorders = extractBorders(value.string, value.borders);
+
+        // A texture consists of a filename between quotes, optionally followed by the part of the image to use
+        std::string::const_iterator c = value.string.begin();
+        if (removeWhitespace(value.string, c) && readFilename(value.string, c, value.filename))
+        {
+            if (removeWhitespace(value.string, c))
+                value.isTexture = readIntRect(value.string.substr(c - value.string.begin()), value.textureRect);
+            else
+                value.isTexture = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> ConfigFile::readImageFilenames() const
+    {
+        std::vector<std::string> filenames;
+
+        // The filenames are relative to the folder of the config file
+        std::string rootPath = "";
+        std::string::size_type slashPos = m_Filename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            rootPath = m_Filename.substr(0, slashPos+1);
+
+        for (auto sectionIt = m_CachedFile->begin(); sectionIt != m_CachedFile->end(); ++sectionIt)
+        {
+            const std::vector<ConfigValue>& values = sectionIt->second.values;
+            for (std::vector<ConfigValue>::const_iterator valueIt = values.begin(); valueIt != values.end(); ++valueIt)
+            {
+                // Other config files can also be referenced, they are not images
+                if (valueIt->isTexture)
+                {
+                    const std::string& filename = valueIt->filename;
+                    if ((filename.length() < 5) || (toLower(filename.substr(filename.length() - 5)) != ".conf"))
+                        filenames.push_back(rootPath + filename);
+                }
+            }
+        }
+
+        return filenames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ConfigFile::addRepeatedParts(const std::string& filename, const std::map<std::string, ConfigSection>& sections)
+    {
+        // The filenames are relative to the folder of the config file
+        std::string rootPath = "";
+        std::string::size_type slashPos = filename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            rootPath = filename.substr(0, slashPos+1);
+
+        for (auto sectionIt = sections.begin(); sectionIt != sections.end(); ++sectionIt)
+        {
+            const ConfigSection& section = sectionIt->second;
+            for (std::vector<std::string>::size_type i = 0; i < section.properties.size(); ++i)
+            {
+                const std::string& property = section.properties[i];
+                if (section.values[i].isTexture && (property.length() > 2) && (property.compare(property.length() - 2, 2, "_m") == 0))
+                    TGUI_TextureManager.addRepeatedPart(rootPath + section.values[i].filename, section.values[i].textureRect);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ConfigFile::readFilename(const std::string& value, std::string::const_iterator& c, std::string& filename) const
+    {
+        // There has to be a quote
+        if (*c == '"')
+            ++c;
+        else
+            return false;
+
+        char prev = '\0';
+
+        // Look for the end quote
+        while (c != value.end())
+        {
+            if ((*c != '"') || (prev == '\\'))
+            {
+                prev = *c;
+                filename.push_back(*c);
+                ++c;
+            }
+            else
+            {
+                ++c;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ConfigFile::removeWhitespace(const std::string& line, std::string::const_iterator& c) const
     {
         while (c != line.end())
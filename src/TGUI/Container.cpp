@@ -26,6 +26,7 @@
 #include <stack>
 #include <cmath>
 #include <cassert>
+#include <algorithm>
 
 #include <TGUI/TGUI.hpp>
 
@@ -35,8 +36,39 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t NameHash::operator()(const sf::String& name) const
+    {
+        // FNV-1a hash over the utf-32 characters
+        std::size_t hash = 2166136261u;
+        for (sf::String::ConstIterator it = name.begin(); it != name.end(); ++it)
+        {
+            hash ^= *it;
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container() :
-        m_FocusedWidget(0)
+        m_FrontZOrder            (0),
+        m_BackZOrder             (0),
+        m_WidgetListValid        (true),
+        m_FocusedWidget          (nullptr),
+        m_TreeNameIndexEnabled   (false),
+        m_TreeNameIndexValid     (false),
+        m_MouseGridValid         (false),
+        m_MouseGridColumns       (0),
+        m_MouseGridRows          (0),
+        m_DrawBoundsValid        (false),
+        m_HoveredWidget          (nullptr),
+        m_FocusChainValid        (false),
+        m_WidgetArena            (nullptr),
+        m_RenderCacheEnabled     (false),
+        m_RenderCacheValid       (false),
+        m_RenderCache            (nullptr)
     {
         m_ContainerWidget = true;
         m_AnimatedWidget = true;
@@ -47,17 +79,33 @@ namespace tgui
 
     Container::Container(const Container& containerToCopy) :
         Widget                   (containerToCopy),
-        m_FocusedWidget          (0),
+        m_FrontZOrder            (0),
+        m_BackZOrder             (0),
+        m_WidgetListValid        (true),
+        m_FocusedWidget          (nullptr),
         m_GlobalFont             (containerToCopy.m_GlobalFont),
-        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions)
+        m_GlobalCallbackFunctions(containerToCopy.m_GlobalCallbackFunctions),
+        m_TreeNameIndexEnabled   (containerToCopy.m_TreeNameIndexEnabled),
+        m_TreeNameIndexValid     (false),
+        m_MouseGridValid         (false),
+        m_MouseGridColumns       (0),
+        m_MouseGridRows          (0),
+        m_DrawBoundsValid        (false),
+        m_HoveredWidget          (nullptr),
+        m_FocusChainValid        (false),
+        m_WidgetArena            (nullptr),
+        m_RenderCacheEnabled     (containerToCopy.m_RenderCacheEnabled),
+        m_RenderCacheValid       (false),
+        m_RenderCache            (nullptr)
     {
         // Copy all the widgets
+        containerToCopy.updateWidgetList();
         for (unsigned int i = 0; i < containerToCopy.m_Widgets.size(); ++i)
         {
-            m_Widgets.push_back(containerToCopy.m_Widgets[i].clone());
-            m_ObjName.push_back(containerToCopy.m_ObjName[i]);
+            Widget::Ptr widget = containerToCopy.m_Widgets[i].clone();
+            widget->m_Parent = this;
 
-            m_Widgets.back()->m_Parent = this;
+            addWidgetSlot(widget, containerToCopy.m_ObjName[i]);
         }
     }
 
@@ -66,6 +114,12 @@ namespace tgui
     Container::~Container()
     {
         removeAllWidgets();
+
+        // The arena stays alive as long as widgets that were allocated from it still exist
+        if (m_WidgetArena != nullptr)
+            m_WidgetArena->removeReference();
+
+        delete m_RenderCache;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,20 +132,24 @@ namespace tgui
             Widget::operator=(right);
 
             // Copy the font and the callback functions
-            m_FocusedWidget = 0;
+            m_FocusedWidget = nullptr;
             m_GlobalFont = right.m_GlobalFont;
             m_GlobalCallbackFunctions = right.m_GlobalCallbackFunctions;
+            m_TreeNameIndexEnabled = right.m_TreeNameIndexEnabled;
+            m_RenderCacheEnabled = right.m_RenderCacheEnabled;
+            m_RenderCacheValid = false;
 
             // Remove all the old widgets
             removeAllWidgets();
 
             // Copy all the widgets
+            right.updateWidgetList();
             for (unsigned int i = 0; i < right.m_Widgets.size(); ++i)
             {
-                m_Widgets.push_back(right.m_Widgets[i].clone());
-                m_ObjName.push_back(right.m_ObjName[i]);
+                Widget::Ptr widget = right.m_Widgets[i].clone();
+                widget->m_Parent = this;
 
-                m_Widgets.back()->m_Parent = this;
+                addWidgetSlot(widget, right.m_ObjName[i]);
             }
         }
 
@@ -123,13 +181,15 @@ namespace tgui
 
     std::vector<Widget::Ptr>& Container::getWidgets()
     {
+        updateWidgetList();
         return m_Widgets;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<sf::String>& Container::getWidgetNames()
+    const std::vector<sf::String>& Container::getWidgetNames() const
     {
+        updateWidgetList();
         return m_ObjName;
     }
 
@@ -140,23 +200,46 @@ namespace tgui
         assert(widgetPtr != nullptr);
 
         widgetPtr->initialize(this);
-        m_Widgets.push_back(widgetPtr);
-        m_ObjName.push_back(widgetName);
+        addWidgetSlot(widgetPtr, widgetName);
+
+        widgetListChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName, bool recursive) const
     {
+        if (!recursive)
+            return getFirstWidgetWithName(widgetName);
+
+        if (m_TreeNameIndexEnabled)
+        {
+            if (!m_TreeNameIndexValid)
+            {
+                m_TreeNameIndex.clear();
+                addToTreeNameIndex(m_TreeNameIndex);
+                m_TreeNameIndexValid = true;
+            }
+
+            // Nothing changed since the index was built, so the container still holds the widget
+            auto it = m_TreeNameIndex.find(widgetName);
+            if (it != m_TreeNameIndex.end())
+                return it->second->getFirstWidgetWithName(widgetName);
+            else
+                return nullptr;
+        }
+
+        // Without the index, the child containers have to be searched in order
+        updateWidgetList();
         for (unsigned int i = 0; i < m_ObjName.size(); ++i)
         {
             if (m_ObjName[i] == widgetName)
             {
                 return m_Widgets[i];
             }
-            else if (recursive && m_Widgets[i]->m_ContainerWidget)
+            else if (m_Widgets[i]->m_ContainerWidget)
             {
-                Widget::Ptr widget = Container::Ptr(m_Widgets[i])->get(widgetName, true);
+                Widget::Ptr widget = static_cast<Container*>(m_Widgets[i].get())->get(widgetName, true);
                 if (widget != nullptr)
                     return widget;
             }
@@ -167,11 +250,59 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Container::getByPath(const sf::String& path) const
+    {
+        const std::basic_string<sf::Uint32> fullPath = path.toUtf32();
+
+        const Container* container = this;
+        std::basic_string<sf::Uint32>::size_type start = 0;
+        while (true)
+        {
+            const std::basic_string<sf::Uint32>::size_type dot = fullPath.find('.', start);
+
+            const sf::String name(fullPath.substr(start, (dot == std::basic_string<sf::Uint32>::npos) ? dot : dot - start));
+
+            const Widget::Ptr widget = container->getFirstWidgetWithName(name);
+            if (widget == nullptr)
+                return nullptr;
+
+            if (dot == std::basic_string<sf::Uint32>::npos)
+                return widget;
+
+            // The widget has to be a container when the path doesn't end here
+            if (!widget->m_ContainerWidget)
+                return nullptr;
+
+            container = static_cast<const Container*>(widget.get());
+            start = dot + 1;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setTreeNameIndexEnabled(bool enabled)
+    {
+        m_TreeNameIndexEnabled = enabled;
+
+        m_TreeNameIndexValid = false;
+        m_TreeNameIndex.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isTreeNameIndexEnabled() const
+    {
+        return m_TreeNameIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Container::copy(const Widget::Ptr& oldWidget, const sf::String& newWidgetName)
     {
         Widget::Ptr newWidget = oldWidget.clone();
-        m_Widgets.push_back(newWidget);
-        m_ObjName.push_back(newWidgetName);
+        addWidgetSlot(newWidget, newWidgetName);
+
+        widgetListChanged();
         return newWidget;
     }
 
@@ -186,73 +317,149 @@ namespace tgui
 
     void Container::remove(Widget* widget)
     {
-        // Loop through every widget
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            // Check if the pointer matches
-            if (m_Widgets[i].get() == widget)
-            {
-                // Unfocus the widget if it was focused
-                if (m_FocusedWidget == i+1)
-                    unfocusWidgets();
+        const unsigned int slot = findWidgetSlot(widget);
+        if (slot < m_WidgetSlots.size())
+            removeWidgetSlot(slot);
+    }
 
-                // Change the index of the focused widget if this is needed
-                if (m_FocusedWidget > i+1)
-                    m_FocusedWidget--;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                // Remove the widget
-                m_Widgets.erase(m_Widgets.begin() + i);
+    void Container::remove(const std::vector<Widget::Ptr>& widgets)
+    {
+        // Removing a widget only clears its own entry in the list returned by getWidgets, so that list can be passed here too
+        for (unsigned int i = 0; i < widgets.size(); ++i)
+            remove(widgets[i].get());
+    }
 
-                // Also emove the name it from the list
-                m_ObjName.erase(m_ObjName.begin() + i);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                break;
-            }
-        }
+    void Container::removeWidgetAt(unsigned int index)
+    {
+        updateWidgetList();
+        removeWidgetSlot(findWidgetSlot(m_Widgets[index].get()));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::removeAllWidgets()
     {
+        // Widgets that are still referenced elsewhere may outlive this container
+        for (unsigned int i = 0; i < m_WidgetSlots.size(); ++i)
+        {
+            if (m_WidgetSlots[i].widget != nullptr)
+                m_WidgetSlots[i].widget->m_Parent = nullptr;
+        }
+
         // Clear the lists
+        m_WidgetSlots.clear();
+        m_FreeWidgetSlots.clear();
+        m_FrontZOrder = 0;
+        m_BackZOrder = 0;
         m_Widgets.clear();
         m_ObjName.clear();
+        m_WidgetListValid = true;
+        m_NameIndex.clear();
+        invalidateTreeNameIndex();
+
+        widgetListChanged();
+        m_HoveredWidget = nullptr;
 
         // There are no more widgets, so none of the widgets can be focused
-        m_FocusedWidget = 0;
+        m_FocusedWidget = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Container::setWidgetName(const Widget::Ptr& widget, const std::string& name)
+    void Container::setWidgetArenaEnabled(bool enabled)
     {
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        if (enabled && (m_WidgetArena == nullptr))
         {
-            if (m_Widgets[i] == widget)
-            {
-                m_ObjName[i] = name;
-                return true;
-            }
+            m_WidgetArena = new WidgetArena;
+            m_WidgetArena->addReference();
+        }
+        else if (!enabled && (m_WidgetArena != nullptr))
+        {
+            m_WidgetArena->removeReference();
+            m_WidgetArena = nullptr;
         }
+    }
 
-        return false;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isWidgetArenaEnabled() const
+    {
+        return m_WidgetArena != nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Container::getWidgetName(const Widget::Ptr& widget, std::string& name) const
+    WidgetArena* Container::getWidgetArena() const
     {
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        const Container* container = this;
+        while (container != nullptr)
         {
-            if (m_Widgets[i] == widget)
-            {
-                name = m_ObjName[i];
-                return true;
-            }
+            if (container->m_WidgetArena != nullptr)
+                return container->m_WidgetArena;
+
+            container = container->m_Parent;
         }
 
-        return false;
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        m_RenderCacheEnabled = enabled;
+        m_RenderCacheValid = false;
+
+        // Don't keep the texture around when it is no longer used
+        if (!enabled)
+        {
+            delete m_RenderCache;
+            m_RenderCache = nullptr;
+        }
+
+        appearanceChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCacheEnabled() const
+    {
+        return m_RenderCacheEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::setWidgetName(const Widget::Ptr& widget, const std::string& name)
+    {
+        const unsigned int slot = findWidgetSlot(widget.get());
+        if (slot == m_WidgetSlots.size())
+            return false;
+
+        const sf::String oldName = m_WidgetSlots[slot].name;
+        m_WidgetSlots[slot].name = name;
+
+        // The order didn't change, but the list of names has to be filled again
+        m_WidgetListValid = false;
+
+        removeFromNameIndex(oldName, widget.get());
+        addToNameIndex(m_WidgetSlots[slot].name, widget);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::getWidgetName(const Widget::Ptr& widget, std::string& name) const
+    {
+        const unsigned int slot = findWidgetSlot(widget.get());
+        if (slot == m_WidgetSlots.size())
+            return false;
+
+        name = m_WidgetSlots[slot].name;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -266,143 +473,147 @@ namespace tgui
 
     void Container::focusWidget(Widget *const widget)
     {
-        // Loop all the widgets
+        // The focus chain knows all widgets in the container, including the ones that can't be focused with the tab key
+        getFocusChain();
+        if (m_FocusChainPositions.find(widget) == m_FocusChainPositions.end())
+            return;
+
+        // Only continue when the widget wasn't already focused
+        if (m_FocusedWidget != widget)
+            setFocusedWidget(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Widget*>& Container::getFocusChain() const
+    {
+        if (m_FocusChainValid)
+            return m_FocusChain;
+
+        updateWidgetList();
+
+        // Widgets are focused in the order of their tab index, widgets with the same tab index in the order of the list
+        std::vector<unsigned int> order(m_Widgets.size());
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            // Search for the widget that has to be focused
-            if (m_Widgets[i].get() == widget)
-            {
-                // Only continue when the widget wasn't already focused
-                if (m_FocusedWidget != i+1)
-                {
-                    // Unfocus the currently focused widget
-                    if (m_FocusedWidget)
-                    {
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-                    }
+            order[i] = i;
 
-                    // Focus the new widget
-                    m_FocusedWidget = i+1;
-                    widget->m_Focused = true;
-                    widget->widgetFocused();
-                }
+        std::stable_sort(order.begin(), order.end(),
+                         [this](unsigned int left, unsigned int right) { return m_Widgets[left]->m_TabIndex < m_Widgets[right]->m_TabIndex; });
 
-                break;
+        // Every widget knows its place in the chain, widgets that can't be focused know where they would be
+        m_FocusChain.clear();
+        m_FocusChainPositions.clear();
+        for (unsigned int i = 0; i < order.size(); ++i)
+        {
+            const Widget* widget = m_Widgets[order[i]].get();
+            if ((widget->m_AllowFocus) && (widget->m_Visible) && (widget->m_Enabled))
+            {
+                m_FocusChainPositions[widget] = FocusChainPosition(m_FocusChain.size(), true);
+                m_FocusChain.push_back(m_Widgets[order[i]].get());
             }
+            else
+                m_FocusChainPositions[widget] = FocusChainPosition(m_FocusChain.size(), false);
         }
+
+        m_FocusChainValid = true;
+        return m_FocusChain;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::focusNextWidget()
+    unsigned int Container::getNextInFocusChain() const
     {
-        // Loop all widgets behind the focused one
-        for (unsigned int i = m_FocusedWidget; i < m_Widgets.size(); ++i)
-        {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i]->m_AllowFocus == true)
-            {
-                // Make sure that the widget is visible and enabled
-                if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
-                {
-                    if (m_FocusedWidget)
-                    {
-                        // unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-                    }
+        if (m_FocusedWidget == nullptr)
+            return 0;
 
-                    // Focus on the new widget
-                    m_FocusedWidget = i+1;
-                    m_Widgets[i]->m_Focused = true;
-                    m_Widgets[i]->widgetFocused();
-                    return;
-                }
-            }
-        }
+        const std::unordered_map<const Widget*, FocusChainPosition>::const_iterator it = m_FocusChainPositions.find(m_FocusedWidget);
+        if (it == m_FocusChainPositions.end())
+            return 0;
 
-        // None of the widgets behind the focused one could be focused, so loop the ones before it
-        if (m_FocusedWidget)
-        {
-            for (unsigned int i = 0; i < m_FocusedWidget - 1; ++i)
-            {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_Widgets[i]->m_AllowFocus == true)
-                {
-                    // Make sure that the widget is visible and enabled
-                    if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
-                    {
-                        // unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
+        if (it->second.inChain)
+            return it->second.index + 1;
+        else
+            return it->second.index;
+    }
 
-                        // Focus on the new widget
-                        m_FocusedWidget = i+1;
-                        m_Widgets[i]->m_Focused = true;
-                        m_Widgets[i]->widgetFocused();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                        return;
-                    }
-                }
-            }
-        }
+    unsigned int Container::getPreviousInFocusChain() const
+    {
+        if (m_FocusedWidget == nullptr)
+            return m_FocusChain.size();
+
+        const std::unordered_map<const Widget*, FocusChainPosition>::const_iterator it = m_FocusChainPositions.find(m_FocusedWidget);
+        if (it == m_FocusChainPositions.end())
+            return m_FocusChain.size();
+
+        return it->second.index;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::focusPreviousWidget()
+    void Container::setFocusedWidget(Widget* widget)
     {
-        // Loop the widgets before the focused one
+        // Unfocus the current widget
         if (m_FocusedWidget)
         {
-            for (unsigned int i = m_FocusedWidget - 1; i > 0; --i)
-            {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_Widgets[i-1]->m_AllowFocus == true)
-                {
-                    // Make sure that the widget is visible and enabled
-                    if ((m_Widgets[i-1]->m_Visible) && (m_Widgets[i-1]->m_Enabled))
-                    {
-                        // unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
+            m_FocusedWidget->m_Focused = false;
+            m_FocusedWidget->widgetUnfocused();
+        }
 
-                        // Focus on the new widget
-                        m_FocusedWidget = i;
-                        m_Widgets[i-1]->m_Focused = true;
-                        m_Widgets[i-1]->widgetFocused();
+        // Focus on the new widget
+        m_FocusedWidget = widget;
+        widget->m_Focused = true;
+        widget->widgetFocused();
 
-                        return;
-                    }
-                }
-            }
-        }
+        appearanceChanged();
+    }
 
-        // None of the widgets before the focused one could be focused, so loop all widgets behind the focused one
-        for (unsigned int i = m_Widgets.size(); i > m_FocusedWidget; --i)
-        {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i-1]->m_AllowFocus == true)
-            {
-                // Make sure that the widget is visible and enabled
-                if ((m_Widgets[i-1]->m_Visible) && (m_Widgets[i-1]->m_Enabled))
-                {
-                    if (m_FocusedWidget)
-                    {
-                        // unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-                    }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    // Focus on the new widget
-                    m_FocusedWidget = i;
-                    m_Widgets[i-1]->m_Focused = true;
-                    m_Widgets[i-1]->widgetFocused();
-                    return;
-                }
-            }
-        }
+    void Container::widgetListChanged()
+    {
+        m_MouseGridValid = false;
+        m_DrawBoundsValid = false;
+        m_FocusChainValid = false;
+
+        appearanceChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::focusNextWidget()
+    {
+        const std::vector<Widget*>& chain = getFocusChain();
+        if (chain.empty())
+            return;
+
+        // Continue from the start when the last widget is focused
+        unsigned int next = getNextInFocusChain();
+        if (next == chain.size())
+            next = 0;
+
+        // Nothing happens when the focused widget is the only one that can be focused
+        if (chain[next] != m_FocusedWidget)
+            setFocusedWidget(chain[next]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::focusPreviousWidget()
+    {
+        const std::vector<Widget*>& chain = getFocusChain();
+        if (chain.empty())
+            return;
+
+        // Continue from the end when the first widget is focused
+        unsigned int previous = getPreviousInFocusChain();
+        if (previous == 0)
+            previous = chain.size();
+
+        // Nothing happens when the focused widget is the only one that can be focused
+        if (chain[previous - 1] != m_FocusedWidget)
+            setFocusedWidget(chain[previous - 1]);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,9 +622,11 @@ namespace tgui
     {
         if (m_FocusedWidget)
         {
-            m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-            m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-            m_FocusedWidget = 0;
+            m_FocusedWidget->m_Focused = false;
+            m_FocusedWidget->widgetUnfocused();
+            m_FocusedWidget = nullptr;
+
+            appearanceChanged();
         }
     }
 
@@ -422,8 +635,13 @@ namespace tgui
     void Container::uncheckRadioButtons()
     {
         // Loop through all radio buttons and uncheck them
+        updateWidgetList();
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
         {
+            // An earlier radio button may have removed this widget from its callback
+            if (m_Widgets[i] == nullptr)
+                continue;
+
             if (m_Widgets[i]->m_Callback.widgetType == Type_RadioButton)
                 static_cast<RadioButton::Ptr>(m_Widgets[i])->uncheck();
         }
@@ -433,60 +651,52 @@ namespace tgui
 
     void Container::moveWidgetToFront(Widget *const widget)
     {
-        // Loop through all widgets
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            // Check if the widget is found
-            if (m_Widgets[i].get() == widget)
-            {
-                // Copy the widget
-                m_Widgets.push_back(m_Widgets[i]);
-                m_ObjName.push_back(m_ObjName[i]);
+        const unsigned int slot = findWidgetSlot(widget);
+        if (slot == m_WidgetSlots.size())
+            return;
 
-                // Focus the correct widget
-                if ((m_FocusedWidget == 0) || (m_FocusedWidget == i+1))
-                    m_FocusedWidget = m_Widgets.size()-1;
-                else if (m_FocusedWidget > i+1)
-                    --m_FocusedWidget;
+        // When no widget was focused then the key events will go to this widget
+        if (m_FocusedWidget == nullptr)
+            m_FocusedWidget = widget;
 
-                // Remove the old widget
-                m_Widgets.erase(m_Widgets.begin() + i);
-                m_ObjName.erase(m_ObjName.begin() + i);
+        // Nothing has to move when the widget already is in front
+        if ((m_WidgetSlots[slot].zOrder == m_FrontZOrder) || (m_WidgetListValid && (m_Widgets.back().get() == widget)))
+            return;
 
-                break;
-            }
-        }
+        // Only the key of the widget changes, the other widgets are sorted again when the list is needed
+        m_WidgetSlots[slot].zOrder = ++m_FrontZOrder;
+        m_WidgetListValid = false;
+
+        // When this was the first widget with its name, then another widget with that name has become the first one
+        NameIndexEntry& entry = m_NameIndex.find(m_WidgetSlots[slot].name)->second;
+        if ((entry.widget.get() == widget) && (entry.count > 1))
+            entry.widget = nullptr;
+
+        invalidateTreeNameIndex();
+        widgetListChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::moveWidgetToBack(Widget *const widget)
     {
-        // Loop through all widgets
-        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-        {
-            // Check if the widget is found
-            if (m_Widgets[i].get() == widget)
-            {
-                // Copy the widget
-                Widget::Ptr obj = m_Widgets[i];
-                std::string name = m_ObjName[i];
-                m_Widgets.insert(m_Widgets.begin(), obj);
-                m_ObjName.insert(m_ObjName.begin(), name);
-
-                // Focus the correct widget
-                if (m_FocusedWidget == i + 1)
-                    m_FocusedWidget = 1;
-                else if (m_FocusedWidget)
-                    ++m_FocusedWidget;
-
-                // Remove the old widget
-                m_Widgets.erase(m_Widgets.begin() + i + 1);
-                m_ObjName.erase(m_ObjName.begin() + i + 1);
-
-                break;
-            }
-        }
+        const unsigned int slot = findWidgetSlot(widget);
+        if (slot == m_WidgetSlots.size())
+            return;
+
+        // Nothing has to move when the widget already is in the back
+        if ((m_WidgetSlots[slot].zOrder == m_BackZOrder) || (m_WidgetListValid && (m_Widgets.front().get() == widget)))
+            return;
+
+        // Only the key of the widget changes, the other widgets are sorted again when the list is needed
+        m_WidgetSlots[slot].zOrder = --m_BackZOrder;
+        m_WidgetListValid = false;
+
+        // The widget is now the first one with its name, there is no need to search for it
+        m_NameIndex.find(m_WidgetSlots[slot].name)->second.widget = m_WidgetSlots[slot].widget;
+
+        invalidateTreeNameIndex();
+        widgetListChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -495,6 +705,7 @@ namespace tgui
     {
         Widget::setTransparency(transparency);
 
+        updateWidgetList();
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
             m_Widgets[i]->setTransparency(transparency);
     }
@@ -755,8 +966,8 @@ namespace tgui
         m_File << tabs << "{" << std::endl;
         tabs += "\t";
 
-        std::function< void (std::vector<sf::String>&, std::vector<Widget::Ptr>&) > saveWidgets;
-        saveWidgets = [this, &m_File, &tabs, &saveWidgets] (std::vector<sf::String>& widgetName, std::vector<Widget::Ptr>& widgets)
+        std::function< void (const std::vector<sf::String>&, std::vector<Widget::Ptr>&) > saveWidgets;
+        saveWidgets = [this, &m_File, &tabs, &saveWidgets] (const std::vector<sf::String>& widgetName, std::vector<Widget::Ptr>& widgets)
         {
             auto nameIt = widgetName.cbegin();
             for (auto widgetIt = widgets.cbegin(); widgetIt != widgets.cend(); ++widgetIt, ++nameIt)
@@ -831,6 +1042,7 @@ namespace tgui
             }
         };
 
+        updateWidgetList();
         saveWidgets(m_ObjName, m_Widgets);
 
         tabs.erase(tabs.length()-1);
@@ -852,7 +1064,10 @@ namespace tgui
     {
         // If there is no global callback function then send the callback to the parent
         if (m_GlobalCallbackFunctions.empty())
-            m_Parent->addChildCallback(callback);
+        {
+            if (m_Parent)
+                m_Parent->addChildCallback(callback);
+        }
         else
         {
             // Loop through all callback functions and call them
@@ -948,8 +1163,8 @@ namespace tgui
         {
             mouseLeftWidget();
 
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            // Tell the widget below the mouse that the mouse is no longer on top of it
+            setHoveredWidget(nullptr);
 
             m_MouseHover = false;
         }
@@ -961,8 +1176,23 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
 
+        updateWidgetList();
         for (unsigned int i=0; i<m_Widgets.size(); ++i)
-            m_Widgets[i]->mouseNoLongerDown();
+        {
+            if (m_Widgets[i] != nullptr)
+                mouseNoLongerDownOnWidget(*m_Widgets[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::mouseNoLongerDownOnWidget(Widget& widget)
+    {
+        // Only a widget on which the mouse went down will look different now
+        if ((widget.m_MouseDown) && (!widget.m_ContainerWidget))
+            appearanceChanged();
+
+        widget.mouseNoLongerDown();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -985,10 +1215,11 @@ namespace tgui
     void Container::update()
     {
         // Loop through all widgets
+        updateWidgetList();
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
         {
-            // Check if the widget is a container or a widget that uses the time
-            if (m_Widgets[i]->m_AnimatedWidget)
+            // Check if the widget is a container or a widget that uses the time (skipping widgets that were removed meanwhile)
+            if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_AnimatedWidget))
             {
                 // Update the elapsed time
                 m_Widgets[i]->m_AnimationTimeElapsed += m_AnimationTimeElapsed;
@@ -1001,8 +1232,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::getTimeUntilUpdate(sf::Time& time) const
+    {
+        // Hidden widgets are updated as well, but nobody will notice when they change
+        updateWidgetList();
+        bool updateScheduled = false;
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            if ((m_Widgets[i]->m_AnimatedWidget) && (m_Widgets[i]->m_Visible))
+            {
+                sf::Time widgetTime;
+                if (m_Widgets[i]->getTimeUntilUpdate(widgetTime))
+                {
+                    if ((updateScheduled == false) || (widgetTime < time))
+                        time = widgetTime;
+
+                    updateScheduled = true;
+                }
+            }
+        }
+
+        return updateScheduled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
+        // Only the events that a widget handles can change how it looks. Containers are left out here, because the widgets
+        // inside them will report the changes themselves. Entering and leaving widgets is reported by the widgets too.
+        updateWidgetList();
+
         // Check if a mouse button has moved
         if (event.type == sf::Event::MouseMoved)
         {
@@ -1010,12 +1270,19 @@ namespace tgui
             for (unsigned int i=0; i<m_Widgets.size(); ++i)
             {
                 // Check if the mouse went down on the widget
-                if (m_Widgets[i]->m_MouseDown)
+                if ((m_Widgets[i] != nullptr) && (m_Widgets[i]->m_MouseDown))
                 {
                     // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
                     if ((m_Widgets[i]->m_DraggableWidget) || (m_Widgets[i]->m_ContainerWidget))
                     {
-                        m_Widgets[i]->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
+                        // The widget changes while it is being dragged
+                        if (!m_Widgets[i]->m_ContainerWidget)
+                            appearanceChanged();
+
+                        // The widget that the mouse leaves may remove this one from its callback
+                        const Widget::Ptr widget = m_Widgets[i];
+                        setHoveredWidget(widget);
+                        widget->mouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
                         return true;
                     }
                 }
@@ -1050,15 +1317,19 @@ namespace tgui
                     if (widget->m_ContainerWidget)
                     {
                         // If another widget was focused then unfocus it now
-                        if ((m_FocusedWidget) && (m_Widgets[m_FocusedWidget-1] != widget))
+                        if ((m_FocusedWidget) && (m_FocusedWidget != widget.get()))
                         {
-                            m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                            m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-                            m_FocusedWidget = 0;
+                            m_FocusedWidget->m_Focused = false;
+                            m_FocusedWidget->widgetUnfocused();
+                            m_FocusedWidget = nullptr;
                         }
                     }
 
                     widget->leftMousePressed(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
+
+                    if (!widget->m_ContainerWidget)
+                        appearanceChanged();
+
                     return true;
                 }
                 else // The mouse didn't went down on a widget, so unfocus the focused widget
@@ -1077,13 +1348,18 @@ namespace tgui
                 // Check if the mouse is on top of a widget
                 Widget::Ptr widget = mouseOnWhichWidget(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
                 if (widget != nullptr)
+                {
                     widget->leftMouseReleased(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
 
-                // Tell all the other widgets that the mouse has gone up
-                for (std::vector<Widget::Ptr>::iterator it = m_Widgets.begin(); it != m_Widgets.end(); ++it)
+                    if (!widget->m_ContainerWidget)
+                        appearanceChanged();
+                }
+
+                // Tell all the other widgets that the mouse has gone up, the callback may have removed some of them
+                for (unsigned int i = 0; i < m_Widgets.size(); ++i)
                 {
-                    if (*it != widget)
-                        (*it)->mouseNoLongerDown();
+                    if ((m_Widgets[i] != widget) && (m_Widgets[i] != nullptr))
+                        mouseNoLongerDownOnWidget(*m_Widgets[i]);
                 }
 
                 if (widget != nullptr)
@@ -1102,8 +1378,13 @@ namespace tgui
                 // Check if there is a focused widget
                 if (m_FocusedWidget)
                 {
-                    // Tell the widget that the key was pressed
-                    m_Widgets[m_FocusedWidget-1]->keyPressed(event.key);
+                    // Tell the widget that the key was pressed (the widget may lose its focus while handling it)
+                    const bool containerWidget = m_FocusedWidget->m_ContainerWidget;
+                    m_FocusedWidget->keyPressed(event.key);
+
+                    if (!containerWidget)
+                        appearanceChanged();
+
                     return true;
                 }
             }
@@ -1116,7 +1397,12 @@ namespace tgui
         {
             // Change the focus to another widget when the tab key was pressed
             if (event.key.code == sf::Keyboard::Tab)
-                return tabKeyPressed();
+            {
+                if (event.key.shift)
+                    return shiftTabKeyPressed();
+                else
+                    return tabKeyPressed();
+            }
             else
                 return false;
         }
@@ -1130,7 +1416,13 @@ namespace tgui
                 // Tell the widget that the key was pressed
                 if (m_FocusedWidget)
                 {
-                    m_Widgets[m_FocusedWidget-1]->textEntered(event.text.unicode);
+                    // The widget may lose its focus while handling the event
+                    const bool containerWidget = m_FocusedWidget->m_ContainerWidget;
+                    m_FocusedWidget->textEntered(event.text.unicode);
+
+                    if (!containerWidget)
+                        appearanceChanged();
+
                     return true;
                 }
             }
@@ -1147,6 +1439,10 @@ namespace tgui
             {
                 // Send the event to the widget
                 widget->mouseWheelMoved(event.mouseWheel.delta, event.mouseWheel.x,  event.mouseWheel.y);
+
+                if (!widget->m_ContainerWidget)
+                    appearanceChanged();
+
                 return true;
             }
 
@@ -1164,37 +1460,42 @@ namespace tgui
         if (TGUI_TabKeyUsageEnabled == false)
             return false;
 
-        // Loop through all widgets
-        for (unsigned int i = m_FocusedWidget; i < m_Widgets.size(); ++i)
+        const std::vector<Widget*>& chain = getFocusChain();
+        for (unsigned int i = getNextInFocusChain(); i < chain.size(); ++i)
         {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i]->m_AllowFocus == true)
+            // Container widgets can only be focused it they contain focusable widgets
+            if ((!chain[i]->m_ContainerWidget) || (static_cast<Container*>(chain[i])->focusNextWidgetInContainer()))
             {
-                // Make sure that the widget is visible and enabled
-                if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
-                {
-                    // Container widgets can only be focused it they contain focusable widgets
-                    if ((!m_Widgets[i]->m_ContainerWidget) || (Container::Ptr(m_Widgets[i])->focusNextWidgetInContainer()))
-                    {
-                        if (m_FocusedWidget > 0)
-                        {
-                            // Unfocus the current widget
-                            m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                            m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-                        }
+                setFocusedWidget(chain[i]);
+                return true;
+            }
+        }
 
-                        // Focus on the new widget
-                        m_FocusedWidget = i+1;
-                        m_Widgets[i]->m_Focused = true;
-                        m_Widgets[i]->widgetFocused();
+        // We have the highest id
+        unfocusWidgets();
+        return false;
+    }
 
-                        return true;
-                    }
-                }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::focusPreviousWidgetInContainer()
+    {
+        // Don't do anything when the tab key usage is disabled
+        if (TGUI_TabKeyUsageEnabled == false)
+            return false;
+
+        const std::vector<Widget*>& chain = getFocusChain();
+        for (unsigned int i = getPreviousInFocusChain(); i > 0; --i)
+        {
+            // Container widgets can only be focused it they contain focusable widgets
+            if ((!chain[i-1]->m_ContainerWidget) || (static_cast<Container*>(chain[i-1])->focusPreviousWidgetInContainer()))
+            {
+                setFocusedWidget(chain[i-1]);
+                return true;
             }
         }
 
-        // We have the highest id
+        // We have the lowest id
         unfocusWidgets();
         return false;
     }
@@ -1208,70 +1509,73 @@ namespace tgui
             return false;
 
         // Check if a container is focused
-        if (m_FocusedWidget)
+        if ((m_FocusedWidget) && (m_FocusedWidget->m_ContainerWidget))
+        {
+            // Focus the next widget in container
+            if (static_cast<Container*>(m_FocusedWidget)->focusNextWidgetInContainer())
+                return true;
+        }
+
+        // Focus the widget after the focused one, or the first one when the last widget is focused
+        const std::vector<Widget*>& chain = getFocusChain();
+        if (!chain.empty())
         {
-            if (m_Widgets[m_FocusedWidget-1]->m_ContainerWidget)
+            unsigned int next = getNextInFocusChain();
+            if (next == chain.size())
+                next = 0;
+
+            if (chain[next] != m_FocusedWidget)
             {
-                // Focus the next widget in container
-                if (Container::Ptr(m_Widgets[m_FocusedWidget-1])->focusNextWidgetInContainer())
-                    return true;
+                setFocusedWidget(chain[next]);
+                return true;
             }
         }
 
-        // Loop all widgets behind the focused one
-        for (unsigned int i = m_FocusedWidget; i < m_Widgets.size(); ++i)
+        // If the currently focused container widget is the only widget to focus, then focus its next child widget
+        if ((m_FocusedWidget) && (m_FocusedWidget->m_ContainerWidget))
         {
-            // If you are not allowed to focus the widget, then skip it
-            if (m_Widgets[i]->m_AllowFocus == true)
-            {
-                // Make sure that the widget is visible and enabled
-                if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
-                {
-                    if (m_FocusedWidget)
-                    {
-                        // unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-                    }
+            static_cast<Container*>(m_FocusedWidget)->tabKeyPressed();
+            return true;
+        }
 
-                    // Focus on the new widget
-                    m_FocusedWidget = i+1;
-                    m_Widgets[i]->m_Focused = true;
-                    m_Widgets[i]->widgetFocused();
-                    return true;
-                }
-            }
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::shiftTabKeyPressed()
+    {
+        // Don't do anything when the tab key usage is disabled
+        if (TGUI_TabKeyUsageEnabled == false)
+            return false;
+
+        // Check if a container is focused
+        if ((m_FocusedWidget) && (m_FocusedWidget->m_ContainerWidget))
+        {
+            // Focus the previous widget in container
+            if (static_cast<Container*>(m_FocusedWidget)->focusPreviousWidgetInContainer())
+                return true;
         }
 
-        // None of the widgets behind the focused one could be focused, so loop the ones before it
-        if (m_FocusedWidget)
+        // Focus the widget before the focused one, or the last one when the first widget is focused
+        const std::vector<Widget*>& chain = getFocusChain();
+        if (!chain.empty())
         {
-            for (unsigned int i=0; i<m_FocusedWidget-1; ++i)
+            unsigned int previous = getPreviousInFocusChain();
+            if (previous == 0)
+                previous = chain.size();
+
+            if (chain[previous - 1] != m_FocusedWidget)
             {
-                // If you are not allowed to focus the widget, then skip it
-                if (m_Widgets[i]->m_AllowFocus == true)
-                {
-                    // Make sure that the widget is visible and enabled
-                    if ((m_Widgets[i]->m_Visible) && (m_Widgets[i]->m_Enabled))
-                    {
-                        // unfocus the current widget
-                        m_Widgets[m_FocusedWidget-1]->m_Focused = false;
-                        m_Widgets[m_FocusedWidget-1]->widgetUnfocused();
-
-                        // Focus on the new widget
-                        m_FocusedWidget = i+1;
-                        m_Widgets[i]->m_Focused = true;
-                        m_Widgets[i]->widgetFocused();
-                        return true;
-                    }
-                }
+                setFocusedWidget(chain[previous - 1]);
+                return true;
             }
         }
 
-        // If the currently focused container widget is the only widget to focus, then focus its next child widget
-        if ((m_FocusedWidget) && (m_Widgets[m_FocusedWidget-1]->m_ContainerWidget))
+        // If the currently focused container widget is the only widget to focus, then focus its previous child widget
+        if ((m_FocusedWidget) && (m_FocusedWidget->m_ContainerWidget))
         {
-            Container::Ptr(m_Widgets[m_FocusedWidget-1])->tabKeyPressed();
+            static_cast<Container*>(m_FocusedWidget)->shiftTabKeyPressed();
             return true;
         }
 
@@ -1282,47 +1586,489 @@ namespace tgui
 
     Widget::Ptr Container::mouseOnWhichWidget(float x, float y)
     {
-        bool widgetFound = false;
-        Widget::Ptr widget = nullptr;
+        if (!m_MouseGridValid)
+            rebuildMouseGrid();
+
+        // Find the cell below the mouse. Outside the grid only the widgets without bounds can be below the mouse.
+        static const std::vector<unsigned int> noWidgets;
+        const std::vector<unsigned int>* cell = &noWidgets;
+        if ((m_MouseGridColumns > 0)
+         && (x >= m_MouseGridArea.left) && (x <= m_MouseGridArea.left + m_MouseGridArea.width)
+         && (y >= m_MouseGridArea.top) && (y <= m_MouseGridArea.top + m_MouseGridArea.height))
+        {
+            unsigned int column = static_cast<unsigned int>((x - m_MouseGridArea.left) * m_MouseGridColumns / m_MouseGridArea.width);
+            unsigned int row = static_cast<unsigned int>((y - m_MouseGridArea.top) * m_MouseGridRows / m_MouseGridArea.height);
+            if (column >= m_MouseGridColumns)
+                column = m_MouseGridColumns - 1;
+            if (row >= m_MouseGridRows)
+                row = m_MouseGridRows - 1;
+
+            cell = &m_MouseGridCells[(row * m_MouseGridColumns) + column];
+        }
 
-        // Loop through all widgets
-        for (std::vector<Widget::Ptr>::reverse_iterator it = m_Widgets.rbegin(); it != m_Widgets.rend(); ++it)
+        // Both lists are sorted, walk through them together from the widget in front to the one in the back
+        Widget::Ptr widget = nullptr;
+        std::vector<unsigned int>::const_reverse_iterator cellIt = cell->rbegin();
+        std::vector<unsigned int>::const_reverse_iterator unboundedIt = m_UnboundedWidgets.rbegin();
+        while ((cellIt != cell->rend()) || (unboundedIt != m_UnboundedWidgets.rend()))
         {
+            unsigned int index;
+            if ((unboundedIt == m_UnboundedWidgets.rend()) || ((cellIt != cell->rend()) && (*cellIt > *unboundedIt)))
+                index = *cellIt++;
+            else
+                index = *unboundedIt++;
+
             // Check if the widget is visible and enabled
-            if (((*it)->m_Visible) && ((*it)->m_Enabled))
+            if ((m_Widgets[index]->m_Visible) && (m_Widgets[index]->m_Enabled))
             {
-                if (widgetFound == false)
+                // Return the widget if the mouse is on top of it
+                if (m_Widgets[index]->mouseOnWidget(x, y))
                 {
-                    // Return the widget if the mouse is on top of it
-                    if ((*it)->mouseOnWidget(x, y))
-                    {
-                        widget = *it;
-                        widgetFound = true;
-                    }
+                    widget = m_Widgets[index];
+                    break;
                 }
-                else // The widget was already found, so tell the other widgets that the mouse can't be on them
-                    (*it)->mouseNotOnWidget();
             }
         }
 
+        // Only the widget that was below the mouse before has to be told that the mouse left it
+        setHoveredWidget(widget);
         return widget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::rebuildMouseGrid()
+    {
+        updateWidgetList();
+
+        m_MouseGridCells.clear();
+        m_UnboundedWidgets.clear();
+
+        // Find the bounds of the widgets and the area that they cover together
+        std::vector<sf::FloatRect> bounds(m_Widgets.size());
+        std::vector<unsigned int> boundedWidgets;
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            if (m_Widgets[i]->getMouseBounds(bounds[i]))
+            {
+                if (boundedWidgets.empty())
+                    m_MouseGridArea = bounds[i];
+                else
+                {
+                    const float right = std::max(m_MouseGridArea.left + m_MouseGridArea.width, bounds[i].left + bounds[i].width);
+                    const float bottom = std::max(m_MouseGridArea.top + m_MouseGridArea.height, bounds[i].top + bounds[i].height);
+                    m_MouseGridArea.left = std::min(m_MouseGridArea.left, bounds[i].left);
+                    m_MouseGridArea.top = std::min(m_MouseGridArea.top, bounds[i].top);
+                    m_MouseGridArea.width = right - m_MouseGridArea.left;
+                    m_MouseGridArea.height = bottom - m_MouseGridArea.top;
+                }
+
+                boundedWidgets.push_back(i);
+            }
+            else
+                m_UnboundedWidgets.push_back(i);
+        }
+
+        m_MouseGridValid = true;
+
+        if ((boundedWidgets.empty()) || (m_MouseGridArea.width <= 0) || (m_MouseGridArea.height <= 0))
+        {
+            // None of the widgets can be below the mouse, unless they have no bounds
+            m_MouseGridColumns = 0;
+            m_MouseGridRows = 0;
+            return;
+        }
+
+        // Use about one cell per widget, so that every cell only contains a few widgets
+        const unsigned int maxCellsPerSide = 64;
+        unsigned int cellsPerSide = static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<float>(boundedWidgets.size()))));
+        if (cellsPerSide > maxCellsPerSide)
+            cellsPerSide = maxCellsPerSide;
+
+        m_MouseGridColumns = cellsPerSide;
+        m_MouseGridRows = cellsPerSide;
+        m_MouseGridCells.resize(m_MouseGridColumns * m_MouseGridRows);
+
+        const float cellWidth = m_MouseGridArea.width / m_MouseGridColumns;
+        const float cellHeight = m_MouseGridArea.height / m_MouseGridRows;
+        for (unsigned int i = 0; i < boundedWidgets.size(); ++i)
+        {
+            const sf::FloatRect& rect = bounds[boundedWidgets[i]];
+            const unsigned int firstColumn = std::min(static_cast<unsigned int>((rect.left - m_MouseGridArea.left) / cellWidth), m_MouseGridColumns - 1);
+            const unsigned int lastColumn = std::min(static_cast<unsigned int>((rect.left + rect.width - m_MouseGridArea.left) / cellWidth), m_MouseGridColumns - 1);
+            const unsigned int firstRow = std::min(static_cast<unsigned int>((rect.top - m_MouseGridArea.top) / cellHeight), m_MouseGridRows - 1);
+            const unsigned int lastRow = std::min(static_cast<unsigned int>((rect.top + rect.height - m_MouseGridArea.top) / cellHeight), m_MouseGridRows - 1);
+
+            for (unsigned int row = firstRow; row <= lastRow; ++row)
+            {
+                for (unsigned int column = firstColumn; column <= lastColumn; ++column)
+                    m_MouseGridCells[(row * m_MouseGridColumns) + column].push_back(boundedWidgets[i]);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateDrawBounds() const
+    {
+        updateWidgetList();
+
+        m_DrawBounds.resize(m_Widgets.size());
+        m_HasDrawBounds.resize(m_Widgets.size());
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+            m_HasDrawBounds[i] = m_Widgets[i]->getDrawBounds(m_DrawBounds[i]);
+
+        m_DrawBoundsValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setHoveredWidget(const Widget::Ptr& widget)
+    {
+        if (m_HoveredWidget == widget)
+            return;
+
+        // The widget decides itself whether it looks different when the mouse leaves it
+        if (m_HoveredWidget != nullptr)
+            m_HoveredWidget->mouseNotOnWidget();
+
+        m_HoveredWidget = widget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::appearanceChanged()
+    {
+        m_RenderCacheValid = false;
+
+        Widget::appearanceChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childBoundsChanged()
+    {
+        // Only the widgets directly inside this container are part of its grid and its draw bounds
+        m_MouseGridValid = false;
+        m_DrawBoundsValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childFocusableChanged()
+    {
+        m_FocusChainValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::updateRenderCaches()
+    {
+        bool rendered = false;
+
+        // Hidden containers aren't drawn, so their caches can wait until they are shown again
+        updateWidgetList();
+        for (unsigned int i = 0; i < m_Widgets.size(); ++i)
+        {
+            if (m_Widgets[i]->m_ContainerWidget && m_Widgets[i]->m_Visible)
+            {
+                if (static_cast<Container*>(m_Widgets[i].get())->updateRenderCaches())
+                    rendered = true;
+            }
+        }
+
+        return rendered;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::RenderTexture* Container::beginRenderCache(const sf::Vector2f& position, const sf::Vector2f& size)
+    {
+        unsigned int width = static_cast<unsigned int>(std::ceil(size.x));
+        unsigned int height = static_cast<unsigned int>(std::ceil(size.y));
+        if ((width == 0) || (height == 0))
+            return nullptr;
+
+        // The texture is only recreated when the container was resized
+        if (m_RenderCache == nullptr)
+            m_RenderCache = new sf::RenderTexture;
+
+        if ((m_RenderCache->getSize().x != width) || (m_RenderCache->getSize().y != height))
+        {
+            if (!m_RenderCache->create(width, height))
+            {
+                TGUI_OUTPUT("TGUI error: Failed to create the render cache of a container.");
+
+                delete m_RenderCache;
+                m_RenderCache = nullptr;
+                return nullptr;
+            }
+        }
+
+        m_RenderCache->setActive(true);
+
+        // Place the view on top of the container, so that the widgets can keep using their absolute position
+        m_RenderCache->setView(sf::View(sf::FloatRect(position.x, position.y, static_cast<float>(width), static_cast<float>(height))));
+        m_RenderCache->clear(sf::Color::Transparent);
+
+        return m_RenderCache;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::endRenderCache()
+    {
+        m_RenderCache->display();
+
+        m_RenderCacheValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateWidgetList() const
+    {
+        if (m_WidgetListValid)
+            return;
+
+        // Sort the slots that hold a widget on their z-order key, the widget in the back comes first
+        std::vector<unsigned int> order;
+        order.reserve(m_WidgetSlots.size() - m_FreeWidgetSlots.size());
+        for (unsigned int i = 0; i < m_WidgetSlots.size(); ++i)
+        {
+            if (m_WidgetSlots[i].widget != nullptr)
+                order.push_back(i);
+        }
+
+        std::sort(order.begin(), order.end(),
+                  [this](unsigned int left, unsigned int right) { return m_WidgetSlots[left].zOrder < m_WidgetSlots[right].zOrder; });
+
+        m_Widgets.clear();
+        m_ObjName.clear();
+        for (unsigned int i = 0; i < order.size(); ++i)
+        {
+            m_WidgetSlots[order[i]].listIndex = i;
+            m_Widgets.push_back(m_WidgetSlots[order[i]].widget);
+            m_ObjName.push_back(m_WidgetSlots[order[i]].name);
+        }
+
+        m_WidgetListValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Container::findWidgetSlot(const Widget* widget) const
+    {
+        if (widget == nullptr)
+            return m_WidgetSlots.size();
+
+        // A widget only remembers its slot in the last container that it was added to, the other ones have to search for it
+        if ((widget->m_ContainerSlot < m_WidgetSlots.size()) && (m_WidgetSlots[widget->m_ContainerSlot].widget.get() == widget))
+            return widget->m_ContainerSlot;
+
+        for (unsigned int i = 0; i < m_WidgetSlots.size(); ++i)
+        {
+            if (m_WidgetSlots[i].widget.get() == widget)
+                return i;
+        }
+
+        return m_WidgetSlots.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addWidgetSlot(const Widget::Ptr& widget, const sf::String& name)
+    {
+        // Reuse the slot of a removed widget when there is one
+        unsigned int slot;
+        if (m_FreeWidgetSlots.empty())
+        {
+            slot = m_WidgetSlots.size();
+            m_WidgetSlots.push_back(WidgetSlot());
+        }
+        else
+        {
+            slot = m_FreeWidgetSlots.back();
+            m_FreeWidgetSlots.pop_back();
+        }
+
+        m_WidgetSlots[slot].widget = widget;
+        m_WidgetSlots[slot].name = name;
+        m_WidgetSlots[slot].zOrder = ++m_FrontZOrder;
+        widget->m_ContainerSlot = slot;
+
+        // The new widget lies in front of all others, so a sorted list only has to be extended
+        if (m_WidgetListValid)
+        {
+            m_WidgetSlots[slot].listIndex = m_Widgets.size();
+            m_Widgets.push_back(widget);
+            m_ObjName.push_back(name);
+        }
+
+        addToNameIndex(name, widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeWidgetSlot(unsigned int slot)
+    {
+        // Keep the widget alive until it is completely removed
+        const Widget::Ptr widget = m_WidgetSlots[slot].widget;
+
+        // Unfocus the widget if it was focused
+        if (m_FocusedWidget == widget.get())
+            unfocusWidgets();
+
+        // Forget the widget if the mouse was on top of it
+        if (m_HoveredWidget == widget)
+            m_HoveredWidget = nullptr;
+
+        // The widget may still be used after it was removed, so it should no longer point to this container
+        widget->m_Parent = nullptr;
+
+        // The other widgets keep their slot, the sorted list is only rebuilt when it is needed
+        const sf::String name = m_WidgetSlots[slot].name;
+        const unsigned int listIndex = m_WidgetSlots[slot].listIndex;
+        if ((listIndex < m_Widgets.size()) && (m_Widgets[listIndex] == widget))
+            m_Widgets[listIndex] = nullptr;
+
+        m_WidgetSlots[slot].widget = nullptr;
+        m_WidgetSlots[slot].name.clear();
+        m_FreeWidgetSlots.push_back(slot);
+        m_WidgetListValid = false;
+
+        removeFromNameIndex(name, widget.get());
+        widgetListChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToNameIndex(const sf::String& name, const Widget::Ptr& widget)
+    {
+        invalidateTreeNameIndex();
+
+        auto it = m_NameIndex.find(name);
+        if (it == m_NameIndex.end())
+        {
+            m_NameIndex.insert(std::make_pair(name, NameIndexEntry(widget)));
+            return;
+        }
+
+        // A widget that was added lies in front of the others with the same name, but a renamed one may lie behind them
+        ++it->second.count;
+        if (m_WidgetSlots[widget->m_ContainerSlot].zOrder != m_FrontZOrder)
+            it->second.widget = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromNameIndex(const sf::String& name, const Widget* widget)
+    {
+        invalidateTreeNameIndex();
+
+        auto it = m_NameIndex.find(name);
+        if (it == m_NameIndex.end())
+            return;
+
+        // There are no more widgets with this name, so the name is no longer stored
+        if (--it->second.count == 0)
+            m_NameIndex.erase(it);
+        else if (it->second.widget.get() == widget)
+            it->second.widget = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::getFirstWidgetWithName(const sf::String& name) const
+    {
+        auto it = m_NameIndex.find(name);
+        if (it == m_NameIndex.end())
+            return nullptr;
+
+        // Search the widget in the back among the widgets with this name when the first one was removed or moved
+        if (it->second.widget == nullptr)
+        {
+            sf::Int64 zOrder = 0;
+            for (unsigned int i = 0; i < m_WidgetSlots.size(); ++i)
+            {
+                if ((m_WidgetSlots[i].widget != nullptr) && (m_WidgetSlots[i].name == name)
+                 && ((it->second.widget == nullptr) || (m_WidgetSlots[i].zOrder < zOrder)))
+                {
+                    it->second.widget = m_WidgetSlots[i].widget;
+                    zOrder = m_WidgetSlots[i].zOrder;
+                }
+            }
+        }
+
+        return it->second.widget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateTreeNameIndex()
+    {
+        // Only this container and the containers that contain it can have the changed widgets in their index
+        for (Container* container = this; container != nullptr; container = container->m_Parent)
+            container->m_TreeNameIndexValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToTreeNameIndex(std::unordered_map<sf::String, const Container*, NameHash>& index) const
+    {
+        // The widgets are added in the same order as they would be searched, a name that is already in the index is kept
+        updateWidgetList();
+        for (unsigned int i = 0; i < m_ObjName.size(); ++i)
+        {
+            index.insert(std::make_pair(m_ObjName[i], this));
+
+            if (m_Widgets[i]->m_ContainerWidget)
+                static_cast<Container*>(m_Widgets[i].get())->addToTreeNameIndex(index);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
-        // Draw all widgets when they are visible
+        if (!m_DrawBoundsValid)
+            updateDrawBounds();
+        else
+            updateWidgetList();
+
+        // The draw bounds are relative to this container, the clipping area uses absolute coordinates
+        const sf::Vector2f offset = getAbsolutePosition() + getWidgetsOffset();
+
+        // Draw all widgets when they are visible and when they lie inside the area that isn't clipped
         for (unsigned int i = 0; i < m_Widgets.size(); ++i)
         {
-            if (m_Widgets[i]->m_Visible)
+            if (m_Widgets[i]->m_Visible == false)
+                continue;
+
+            if (m_HasDrawBounds[i])
+            {
+                const sf::FloatRect bounds(m_DrawBounds[i].left + offset.x, m_DrawBounds[i].top + offset.y, m_DrawBounds[i].width, m_DrawBounds[i].height);
+                if (ClipStack::isWidgetVisible(*target, &bounds))
+                    m_Widgets[i]->draw(*target, states);
+            }
+            else
+            {
+                ClipStack::isWidgetVisible(*target, nullptr);
                 m_Widgets[i]->draw(*target, states);
+            }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    GuiContainer::GuiContainer() :
+        m_Window      (nullptr),
+        m_RedrawNeeded(true)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::unbindGlobalCallback()
     {
         m_GlobalCallbackFunctions.erase(++m_GlobalCallbackFunctions.begin(), m_GlobalCallbackFunctions.end());
@@ -1362,6 +2108,15 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::appearanceChanged()
+    {
+        m_RedrawNeeded = true;
+
+        Container::appearanceChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Container.hpp>
 #include <TGUI/EditBox.hpp>
 #include <TGUI/Clipboard.hpp>
@@ -70,6 +68,8 @@ namespace tgui
     EditBox::EditBox(const EditBox& copy) :
     ClickableWidget         (copy),
     WidgetBorders           (copy),
+    onTextChanged           (copy.onTextChanged),
+    onReturnKeyPressed      (copy.onReturnKeyPressed),
     m_LoadedConfigFile      (copy.m_LoadedConfigFile),
     m_SelectionPointVisible (copy.m_SelectionPointVisible),
     m_LimitTextWidth        (copy.m_LimitTextWidth),
@@ -132,6 +132,8 @@ namespace tgui
             this->ClickableWidget::operator=(right);
             this->WidgetBorders::operator=(right);
 
+            std::swap(onTextChanged,            temp.onTextChanged);
+            std::swap(onReturnKeyPressed,       temp.onReturnKeyPressed);
             std::swap(m_LoadedConfigFile,       temp.m_LoadedConfigFile);
             std::swap(m_SelectionPointVisible,  temp.m_SelectionPointVisible);
             std::swap(m_LimitTextWidth,         temp.m_LimitTextWidth);
@@ -180,6 +182,8 @@ namespace tgui
 
     bool EditBox::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -206,10 +210,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("EditBox", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("EditBox");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -225,10 +228,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "separatehoverimage")
             {
@@ -236,30 +239,30 @@ namespace tgui
             }
             else if (property == "textcolor")
             {
-                sf::Color color = extractColor(value);
+                sf::Color color = configFile.readColor(value);
                 m_TextBeforeSelection.setColor(color);
                 m_TextAfterSelection.setColor(color);
             }
             else if (property == "selectedtextcolor")
             {
-                m_TextSelection.setColor(extractColor(value));
+                m_TextSelection.setColor(configFile.readColor(value));
             }
             else if (property == "selectedtextbackgroundcolor")
             {
-                m_SelectedTextBackground.setFillColor(extractColor(value));
+                m_SelectedTextBackground.setFillColor(configFile.readColor(value));
             }
             else if (property == "selectionpointcolor")
             {
-                m_SelectionPoint.setFillColor(extractColor(value));
+                m_SelectionPoint.setFillColor(configFile.readColor(value));
             }
             else if (property == "selectionpointwidth")
             {
-                m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(atof(value.c_str())), m_SelectionPoint.getSize().y));
+                m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(atof(value.string.c_str())), m_SelectionPoint.getSize().y));
             }
             else if (property == "borders")
             {
                 Borders borders;
-                if (extractBorders(value, borders))
+                if (configFile.readBorders(value, borders))
                     setBorders(borders.left, borders.top, borders.right, borders.bottom);
             }
             else if (property == "normalimage")
@@ -376,7 +379,7 @@ namespace tgui
                 setSize(static_cast<float>(m_TextureNormal_L.getSize().x + m_TextureNormal_M.getSize().x + m_TextureNormal_R.getSize().x),
                         static_cast<float>(m_TextureNormal_M.getSize().y));
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -389,13 +392,13 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Focused;
 
-                m_TextureFocused_M.data->texture.setRepeated(true);
+                m_TextureFocused_M.setRepeated(true);
             }
             if ((m_TextureHover_L.data != nullptr) && (m_TextureHover_M.data != nullptr) && (m_TextureHover_R.data != nullptr))
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureHover_M.data->texture.setRepeated(true);
+                m_TextureHover_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -490,6 +493,7 @@ namespace tgui
         // Store the new size
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         // A negative size is not allowed for this widget
         if (m_Size.x < 0) m_Size.x = -m_Size.x;
@@ -512,9 +516,9 @@ namespace tgui
             m_TextureNormal_L.sprite.setScale(scalingY, scalingY);
             m_TextureFocused_L.sprite.setScale(scalingY, scalingY);
 
-            m_TextureHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
-            m_TextureNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
-            m_TextureFocused_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
+            m_TextureHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureHover_M.getSize().y));
+            m_TextureNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureNormal_M.getSize().y));
+            m_TextureFocused_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scalingY), m_TextureFocused_M.getSize().y));
 
             m_TextureHover_M.sprite.setScale(scalingY, scalingY);
             m_TextureNormal_M.sprite.setScale(scalingY, scalingY);
@@ -543,6 +547,8 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        appearanceChanged();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -662,6 +668,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -681,6 +689,8 @@ namespace tgui
         m_TextFull.setFont(font);
 
         recalculateTextPositions();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -694,6 +704,8 @@ namespace tgui
 
     void EditBox::setPasswordCharacter(char passwordChar)
     {
+        appearanceChanged();
+
         // Don't do anything when the edit box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -735,6 +747,8 @@ namespace tgui
             // Set the selection point behind the last character
             setSelectionPointPosition(m_DisplayedText.getSize());
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -760,6 +774,8 @@ namespace tgui
         // Set the size of the selection point
         m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(m_SelectionPoint.getSize().x),
                                           m_Size.y - ((m_BottomBorder + m_TopBorder) * (m_Size.y / m_TextureNormal_M.getSize().y))));
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -775,6 +791,8 @@ namespace tgui
 
         m_SelectionPoint.setFillColor(selectionPointColor);
         m_SelectedTextBackground.setFillColor(selectedBgrColor);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -783,6 +801,8 @@ namespace tgui
     {
         m_TextBeforeSelection.setColor(textColor);
         m_TextAfterSelection.setColor(textColor);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -790,6 +810,7 @@ namespace tgui
     void EditBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
         m_TextSelection.setColor(selectedTextColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -797,6 +818,7 @@ namespace tgui
     void EditBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
         m_SelectedTextBackground.setFillColor(selectedTextBackgroundColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -804,6 +826,7 @@ namespace tgui
     void EditBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
         m_SelectionPoint.setFillColor(selectionPointColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -924,6 +947,8 @@ namespace tgui
         }
 
         recalculateTextPositions();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -934,6 +959,8 @@ namespace tgui
         m_SelectionPoint.setSize(sf::Vector2f(static_cast<float>(width),
                                           m_Size.y - ((m_BottomBorder + m_TopBorder) * (m_Size.y / m_TextureNormal_M.getSize().y))));
 
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -977,6 +1004,8 @@ namespace tgui
             if (newText != m_Text)
                 setText(newText);
         }
+
+        appearanceChanged();
     }
 
 
@@ -1066,7 +1095,7 @@ namespace tgui
         m_MouseDown = true;
 
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMousePressed].empty() == false)
+        if (isCallbackBound(LeftMousePressed))
         {
             m_Callback.trigger = LeftMousePressed;
             m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -1280,11 +1309,14 @@ namespace tgui
         }
         else if (event.code == sf::Keyboard::Return)
         {
-            // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ReturnKeyPressed].empty() == false)
+            // Send the signal and add the callback (if the user requested it)
+            onReturnKeyPressed(m_Text);
+            if (isCallbackBound(ReturnKeyPressed))
             {
                 m_Callback.trigger = ReturnKeyPressed;
-                m_Callback.text    = m_Text;
+                if (isCallbackDataNeeded(ReturnKeyPressed))
+                    m_Callback.text = m_Text;
+
                 addCallback();
             }
         }
@@ -1334,11 +1366,14 @@ namespace tgui
             m_SelectionPointVisible = true;
             m_AnimationTimeElapsed = sf::Time();
 
-            // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[TextChanged].empty() == false)
+            // Send the signal and add the callback (if the user requested it)
+            onTextChanged(m_Text);
+            if (isCallbackBound(TextChanged))
             {
                 m_Callback.trigger = TextChanged;
-                m_Callback.text    = m_Text;
+                if (isCallbackDataNeeded(TextChanged))
+                    m_Callback.text = m_Text;
+
                 addCallback();
             }
         }
@@ -1388,11 +1423,14 @@ namespace tgui
             m_SelectionPointVisible = true;
             m_AnimationTimeElapsed = sf::Time();
 
-            // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[TextChanged].empty() == false)
+            // Send the signal and add the callback (if the user requested it)
+            onTextChanged(m_Text);
+            if (isCallbackBound(TextChanged))
             {
                 m_Callback.trigger = TextChanged;
-                m_Callback.text    = m_Text;
+                if (isCallbackDataNeeded(TextChanged))
+                    m_Callback.text = m_Text;
+
                 addCallback();
             }
         }
@@ -1423,11 +1461,14 @@ namespace tgui
 
                         setSelectionPointPosition(oldCaretPos + clipboardContents.getSize());
 
-                        // Add the callback (if the user requested it)
-                        if (m_CallbackFunctions[TextChanged].empty() == false)
+                        // Send the signal and add the callback (if the user requested it)
+                        onTextChanged(m_Text);
+                        if (isCallbackBound(TextChanged))
                         {
                             m_Callback.trigger = TextChanged;
-                            m_Callback.text    = m_Text;
+                            if (isCallbackDataNeeded(TextChanged))
+                                m_Callback.text = m_Text;
+
                             addCallback();
                         }
                     }
@@ -1542,11 +1583,14 @@ namespace tgui
         m_SelectionPointVisible = true;
         m_AnimationTimeElapsed = sf::Time();
 
-        // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[TextChanged].empty() == false)
+        // Send the signal and add the callback (if the user requested it)
+        onTextChanged(m_Text);
+        if (isCallbackBound(TextChanged))
         {
             m_Callback.trigger = TextChanged;
-            m_Callback.text    = m_Text;
+            if (isCallbackDataNeeded(TextChanged))
+                m_Callback.text = m_Text;
+
             addCallback();
         }
     }
@@ -1711,9 +1755,9 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TextChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TextChanged).size() == 1) && (m_CallbackFunctions.at(TextChanged).front() == nullptr))
+            if (isOnlyBoundToParent(TextChanged))
                 callbacks.push_back("TextChanged");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+            if (isOnlyBoundToParent(ReturnKeyPressed))
                 callbacks.push_back("ReturnKeyPressed");
 
             encodeList(callbacks, value);
@@ -2011,12 +2055,32 @@ namespace tgui
         // Switch the value of the visible flag
         m_SelectionPointVisible = !m_SelectionPointVisible;
 
+        // The selection point is only drawn while the widget is focused
+        if (m_Focused)
+            appearanceChanged();
+
         // Too slow for double clicking
         m_PossibleDoubleClick = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::getTimeUntilUpdate(sf::Time& time) const
+    {
+        // The selection point is only drawn while the widget is focused
+        if ((m_Focused == false) || (m_Visible == false))
+            return false;
+
+        if (m_AnimationTimeElapsed < sf::milliseconds(500))
+            time = sf::milliseconds(500) - m_AnimationTimeElapsed;
+        else
+            time = sf::Time::Zero;
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Don't draw anything when the edit box was not loaded correctly
@@ -2029,38 +2093,38 @@ namespace tgui
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    RenderBatch::draw(target, m_TextureHover_L, states);
+                    RenderBatch::draw(target, m_TextureHover_M, states);
+                    RenderBatch::draw(target, m_TextureHover_R, states);
                 }
                 else
                 {
-                    target.draw(m_TextureNormal_L, states);
-                    target.draw(m_TextureNormal_M, states);
-                    target.draw(m_TextureNormal_R, states);
+                    RenderBatch::draw(target, m_TextureNormal_L, states);
+                    RenderBatch::draw(target, m_TextureNormal_M, states);
+                    RenderBatch::draw(target, m_TextureNormal_R, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureNormal_L, states);
-                target.draw(m_TextureNormal_M, states);
-                target.draw(m_TextureNormal_R, states);
+                RenderBatch::draw(target, m_TextureNormal_L, states);
+                RenderBatch::draw(target, m_TextureNormal_M, states);
+                RenderBatch::draw(target, m_TextureNormal_R, states);
 
                 // When the mouse is on top of the edit box then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureHover_L, states);
-                    target.draw(m_TextureHover_M, states);
-                    target.draw(m_TextureHover_R, states);
+                    RenderBatch::draw(target, m_TextureHover_L, states);
+                    RenderBatch::draw(target, m_TextureHover_M, states);
+                    RenderBatch::draw(target, m_TextureHover_R, states);
                 }
             }
 
             // When the edit box is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
             {
-                target.draw(m_TextureFocused_L, states);
-                target.draw(m_TextureFocused_M, states);
-                target.draw(m_TextureFocused_R, states);
+                RenderBatch::draw(target, m_TextureFocused_L, states);
+                RenderBatch::draw(target, m_TextureFocused_M, states);
+                RenderBatch::draw(target, m_TextureFocused_R, states);
             }
         }
         else // The images aren't split
@@ -2068,22 +2132,22 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureHover_M, states);
+                    RenderBatch::draw(target, m_TextureHover_M, states);
                 else
-                    target.draw(m_TextureNormal_M, states);
+                    RenderBatch::draw(target, m_TextureNormal_M, states);
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureNormal_M, states);
+                RenderBatch::draw(target, m_TextureNormal_M, states);
 
                 // When the mouse is on top of the edit box then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureHover_M, states);
+                    RenderBatch::draw(target, m_TextureHover_M, states);
             }
 
             // When the edit box is focused then draw an extra image
             if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-                target.draw(m_TextureFocused_M, states);
+                RenderBatch::draw(target, m_TextureFocused_M, states);
         }
 
         // Calculate the scaling
@@ -2096,52 +2160,33 @@ namespace tgui
         else
             borderScale = scaling.x;
 
-        // Calculate the scale factor of the view
-        const sf::View& view = target.getView();
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x + (m_LeftBorder * borderScale) - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y + (m_TopBorder * scaling.y) - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + (m_Size.x - (m_RightBorder * borderScale)) - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + (m_Size.y - (m_BottomBorder * scaling.y)) - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        // The text is also clipped when the edit box is drawn without gui
+        ClipStack clipStack;
+        clipStack.beginIfInactive(target);
 
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // Only draw the text inside the borders
+        ClipStack::push(target, sf::FloatRect(getAbsolutePosition().x + (m_LeftBorder * borderScale),
+                                              getAbsolutePosition().y + (m_TopBorder * scaling.y),
+                                              m_Size.x - ((m_LeftBorder + m_RightBorder) * borderScale),
+                                              m_Size.y - ((m_TopBorder + m_BottomBorder) * scaling.y)));
 
-        target.draw(m_TextBeforeSelection, states);
+        RenderBatch::draw(target, m_TextBeforeSelection, states);
 
         if (m_TextSelection.getString().isEmpty() == false)
         {
-            target.draw(m_SelectedTextBackground, states);
+            RenderBatch::draw(target, m_SelectedTextBackground, states);
 
-            target.draw(m_TextSelection, states);
-            target.draw(m_TextAfterSelection, states);
+            RenderBatch::draw(target, m_TextSelection, states);
+            RenderBatch::draw(target, m_TextAfterSelection, states);
         }
 
         // Draw the selection point
         if ((m_Focused) && (m_SelectionPointVisible))
-            target.draw(m_SelectionPoint, states);
+            RenderBatch::draw(target, m_SelectionPoint, states);
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        ClipStack::pop(target);
+        clipStack.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,8 +346,8 @@ void FormBuilder::menuBarCallback(const tgui::Callback& callback)
         widgetSelector->setSelectedItem(0);
 
         // Fill the WidgetData structs about the widgets (causes the widgets to be deleted)
-        auto& widgets = formPanel->getWidgets();
-        for (unsigned int i = 0; i < widgets.size();)
+        const std::vector<tgui::Widget::Ptr> widgets = formPanel->getWidgets();
+        for (unsigned int i = 0; i < widgets.size(); ++i)
         {
             std::string widgetName;
             formPanel->getWidgetName(widgets[i], widgetName);
@@ -47,6 +47,7 @@ namespace tgui
     m_Size        (gridToCopy.m_Size),
     m_IntendedSize(gridToCopy.m_IntendedSize)
     {
+        gridToCopy.updateWidgetList();
         const std::vector<Widget::Ptr>& widgets = gridToCopy.m_Widgets;
 
         for (unsigned int row = 0; row < gridToCopy.m_GridWidgets.size(); ++row)
@@ -112,6 +113,8 @@ namespace tgui
         m_IntendedSize.y = height;
 
         updatePositionsOfAllWidgets();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +186,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Grid::remove(const std::vector<Widget::Ptr>& widgets)
+    {
+        // Every widget also has to be removed from the rows and columns of the grid
+        for (unsigned int i = 0; i < widgets.size(); ++i)
+            remove(widgets[i].get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Grid::removeAllWidgets()
     {
         m_GridWidgets.clear();
@@ -234,6 +246,8 @@ namespace tgui
 
         // Update the widgets
         updateWidgets();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -298,6 +312,8 @@ namespace tgui
                 }
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -390,6 +406,8 @@ namespace tgui
                 }
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -534,9 +552,8 @@ namespace tgui
         {
             mouseLeftWidget();
 
-            // Tell the widgets inside the grid that the mouse is no longer on top of them
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            // Tell the widget below the mouse that the mouse is no longer on top of it
+            setHoveredWidget(nullptr);
 
             m_MouseHover = false;
         }
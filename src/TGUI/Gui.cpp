@@ -23,11 +23,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
+#include <limits>
+#include <algorithm>
 
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/RecordingTarget.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,8 +38,24 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
-        m_Window        (nullptr),
-        m_accessToWindow(false)
+        m_CallbackQueue              (32),
+        m_CallbackQueueStart         (0),
+        m_CallbackQueueSize          (0),
+        m_CallbackQueueHighWatermark (0),
+        m_Window                     (nullptr),
+        m_accessToWindow             (false),
+        m_MouseMoveCoalescing        (false),
+        m_MaxPendingMouseMoves       (0),
+        m_PendingMouseMoves          (0),
+        m_PendingMouseMove           (),
+        m_PendingMouseMoveResetView  (true),
+        m_CoalescedMouseMoves        (0),
+        m_CommandQueueHead           (&m_CommandQueueStub),
+        m_CommandQueueTail           (&m_CommandQueueStub),
+        m_CommandQueueStub           (),
+        m_PendingCommands            (0),
+        m_CommandBudget              (0),
+        m_ClipAreaSet                (false)
     {
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
 
@@ -47,8 +65,24 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui(sf::RenderWindow& window) :
-        m_Window        (&window),
-        m_accessToWindow(true)
+        m_CallbackQueue              (32),
+        m_CallbackQueueStart         (0),
+        m_CallbackQueueSize          (0),
+        m_CallbackQueueHighWatermark (0),
+        m_Window                     (&window),
+        m_accessToWindow             (true),
+        m_MouseMoveCoalescing        (false),
+        m_MaxPendingMouseMoves       (0),
+        m_PendingMouseMoves          (0),
+        m_PendingMouseMove           (),
+        m_PendingMouseMoveResetView  (true),
+        m_CoalescedMouseMoves        (0),
+        m_CommandQueueHead           (&m_CommandQueueStub),
+        m_CommandQueueTail           (&m_CommandQueueStub),
+        m_CommandQueueStub           (),
+        m_PendingCommands            (0),
+        m_CommandBudget              (0),
+        m_ClipAreaSet                (false)
     {
         m_Container.m_Window = &window;
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
@@ -61,8 +95,24 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui(sf::RenderTarget& window) :
-        m_Window        (&window),
-        m_accessToWindow(false)
+        m_CallbackQueue              (32),
+        m_CallbackQueueStart         (0),
+        m_CallbackQueueSize          (0),
+        m_CallbackQueueHighWatermark (0),
+        m_Window                     (&window),
+        m_accessToWindow             (false),
+        m_MouseMoveCoalescing        (false),
+        m_MaxPendingMouseMoves       (0),
+        m_PendingMouseMoves          (0),
+        m_PendingMouseMove           (),
+        m_PendingMouseMoveResetView  (true),
+        m_CoalescedMouseMoves        (0),
+        m_CommandQueueHead           (&m_CommandQueueStub),
+        m_CommandQueueTail           (&m_CommandQueueStub),
+        m_CommandQueueStub           (),
+        m_PendingCommands            (0),
+        m_CommandBudget              (0),
+        m_ClipAreaSet                (false)
     {
         m_Container.m_Window = &window;
         m_Container.bindGlobalCallback(&Gui::addChildCallback, this);
@@ -72,6 +122,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Gui::~Gui()
+    {
+        // The commands that are still queued are destroyed without executing them
+        CommandNode* node;
+        while ((node = popCommand()) != nullptr)
+            delete node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::setWindow(sf::RenderWindow& window)
     {
         m_accessToWindow = true;
@@ -102,6 +162,140 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Gui::handleEvent(sf::Event event, bool resetView)
+    {
+        if (m_MouseMoveCoalescing)
+        {
+            if (event.type == sf::Event::MouseMoved)
+            {
+                // Only the newest mouse position is passed to the widgets
+                if (m_PendingMouseMoves > 0)
+                    ++m_CoalescedMouseMoves;
+
+                m_PendingMouseMove = event;
+                m_PendingMouseMoveResetView = resetView;
+                ++m_PendingMouseMoves;
+
+                if ((m_MaxPendingMouseMoves > 0) && (m_PendingMouseMoves >= m_MaxPendingMouseMoves))
+                    return handlePendingMouseMove();
+                else
+                    return false;
+            }
+
+            // The widgets have to know where the mouse is before they receive the next event
+            handlePendingMouseMove();
+        }
+
+        return dispatchEvent(event, resetView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::postCommand(const std::function<void()>& command)
+    {
+        CommandNode* node = new CommandNode;
+        node->command = command;
+
+        m_PendingCommands.fetch_add(1, std::memory_order_relaxed);
+        pushCommand(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::processCommands()
+    {
+        unsigned int executed = 0;
+        while ((m_CommandBudget == 0) || (executed < m_CommandBudget))
+        {
+            CommandNode* node = popCommand();
+            if (node == nullptr)
+                break;
+
+            m_PendingCommands.fetch_sub(1, std::memory_order_relaxed);
+            ++executed;
+
+            node->command();
+            delete node;
+        }
+
+        return executed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setCommandBudget(unsigned int maxCommands)
+    {
+        m_CommandBudget = maxCommands;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getCommandBudget() const
+    {
+        return m_CommandBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getPendingCommandCount() const
+    {
+        return m_PendingCommands.load(std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::pushCommand(CommandNode* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+
+        // Make the node the new head, then link the previous head to it
+        CommandNode* previous = m_CommandQueueHead.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Gui::CommandNode* Gui::popCommand()
+    {
+        CommandNode* tail = m_CommandQueueTail;
+        CommandNode* next = tail->next.load(std::memory_order_acquire);
+
+        // Skip the stub node
+        if (tail == &m_CommandQueueStub)
+        {
+            if (next == nullptr)
+                return nullptr;
+
+            m_CommandQueueTail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr)
+        {
+            m_CommandQueueTail = next;
+            return tail;
+        }
+
+        // When the tail isn't the head then a producer is still busy linking a new node, try again next time
+        if (tail != m_CommandQueueHead.load(std::memory_order_acquire))
+            return nullptr;
+
+        // The tail is the last node, push the stub behind it so that the tail can be popped
+        pushCommand(&m_CommandQueueStub);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            m_CommandQueueTail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::dispatchEvent(sf::Event event, bool resetView)
     {
         // Check if the event has something to do with the mouse
         if (event.type == sf::Event::MouseMoved)
@@ -162,6 +356,12 @@ namespace tgui
 
     void Gui::draw(bool resetView)
     {
+        // Execute the commands that were posted by other threads
+        processCommands();
+
+        // Mouse moves are not held back for longer than a frame
+        handlePendingMouseMove();
+
         sf::View oldView = m_Window->getView();
 
         // Reset the view when requested
@@ -174,32 +374,180 @@ namespace tgui
         else
             m_Clock.restart();
 
-        // Check if clipping is enabled
-        GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
-        GLint scissor[4];
+        // A recording target only keeps the draw calls of a single frame
+        RecordingTarget* recorder = dynamic_cast<RecordingTarget*>(m_Window);
+        if (recorder)
+            recorder->beginFrame();
 
-        if (clippingEnabled)
+        // Draw the outdated render caches first, they use their own texture so the window has to be activated again afterwards.
+        // Render caches are never updated while recording, the containers then draw their widgets directly.
+        if ((recorder == nullptr) && m_Container.updateRenderCaches())
         {
-            // Remember the old clipping area
-            glGetIntegerv(GL_SCISSOR_BOX, scissor);
-        }
-        else // Clipping was disabled
-        {
-            // Enable clipping
-            glEnable(GL_SCISSOR_TEST);
-            glScissor(0, 0, m_Window->getSize().x, m_Window->getSize().y);
+            if (m_accessToWindow)
+                static_cast<sf::RenderWindow*>(m_Window)->setActive(true);
+            else
+            {
+                sf::RenderTexture* texture = dynamic_cast<sf::RenderTexture*>(m_Window);
+                if (texture)
+                    texture->setActive(true);
+            }
         }
 
-        // Draw the window with all widgets inside it
+        // Draw the window with all widgets inside it. Clipping is enabled on the whole window while the widgets are drawn,
+        // unless the application told us that it already clips to a smaller area.
+        if (m_ClipAreaSet)
+            m_ClipStack.begin(*m_Window, m_ClipArea);
+        else
+            m_ClipStack.begin(*m_Window);
+
+        m_RenderBatch.begin(*m_Window);
         m_Container.drawWidgetContainer(m_Window, sf::RenderStates::Default);
+        m_RenderBatch.end();
+        m_ClipStack.end();
+
+        m_Window->setView(oldView);
+
+        m_Container.m_RedrawNeeded = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        return timeUntilNextUpdate() == sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Reset clipping to its original state
-        if (clippingEnabled)
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+    sf::Time Gui::timeUntilNextUpdate() const
+    {
+        // Pending mouse moves and commands are handled when drawing
+        if (m_Container.m_RedrawNeeded || (m_PendingMouseMoves > 0) || (m_PendingCommands.load(std::memory_order_relaxed) > 0))
+            return sf::Time::Zero;
+
+        // The elapsed time is only passed to the widgets while the gui is focused
+        sf::Time time;
+        if ((m_Container.m_Focused == false) || (m_Container.getTimeUntilUpdate(time) == false))
+            return sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+        // The times of the widgets are counted from the last call to draw
+        const sf::Time elapsed = m_Clock.getElapsedTime();
+        if (elapsed >= time)
+            return sf::Time::Zero;
         else
-            glDisable(GL_SCISSOR_TEST);
+            return time - elapsed;
+    }
 
-        m_Window->setView(oldView);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setMouseMoveCoalescing(bool enabled, unsigned int maxPendingEvents)
+    {
+        if (!enabled)
+            handlePendingMouseMove();
+
+        m_MouseMoveCoalescing = enabled;
+        m_MaxPendingMouseMoves = maxPendingEvents;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isMouseMoveCoalescingEnabled() const
+    {
+        return m_MouseMoveCoalescing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::handlePendingMouseMove()
+    {
+        if (m_PendingMouseMoves == 0)
+            return false;
+
+        m_PendingMouseMoves = 0;
+        return dispatchEvent(m_PendingMouseMove, m_PendingMouseMoveResetView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getCoalescedMouseMoveCount() const
+    {
+        return m_CoalescedMouseMoves;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::resetCoalescedMouseMoveCount()
+    {
+        m_CoalescedMouseMoves = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setBatchingEnabled(bool enabled)
+    {
+        m_RenderBatch.setEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isBatchingEnabled() const
+    {
+        return m_RenderBatch.isEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getDrawCallCount() const
+    {
+        return m_RenderBatch.getDrawCallCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getClipChangeCount() const
+    {
+        return m_ClipStack.getScissorChangeCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setClipArea(const sf::IntRect& area)
+    {
+        m_ClipAreaSet = true;
+        m_ClipArea = area;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::resetClipArea()
+    {
+        m_ClipAreaSet = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::IntRect Gui::getClipArea() const
+    {
+        if (m_ClipAreaSet)
+            return m_ClipArea;
+        else if (m_Window != nullptr)
+            return sf::IntRect(0, 0, static_cast<int>(m_Window->getSize().x), static_cast<int>(m_Window->getSize().y));
+        else
+            return sf::IntRect();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getDrawnWidgetCount() const
+    {
+        return m_ClipStack.getDrawnWidgetCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getCulledWidgetCount() const
+    {
+        return m_ClipStack.getCulledWidgetCount();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -207,15 +555,16 @@ namespace tgui
     bool Gui::pollCallback(Callback& callback)
     {
         // Check if the callback queue is empty
-        if (m_Callback.empty())
+        if (m_CallbackQueueSize == 0)
             return false;
         else // The queue is not empty
         {
             // Get the next callback
-            callback = m_Callback.front();
+            callback = m_CallbackQueue[m_CallbackQueueStart];
 
             // Remove the callback from the queue
-            m_Callback.pop();
+            m_CallbackQueueStart = (m_CallbackQueueStart + 1) % m_CallbackQueue.size();
+            --m_CallbackQueueSize;
 
             return true;
         }
@@ -223,6 +572,64 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int Gui::pollCallbacks(Callback* callbacks, unsigned int maxCallbacks)
+    {
+        unsigned int count = 0;
+        while ((count < maxCallbacks) && (m_CallbackQueueSize > 0))
+        {
+            callbacks[count] = m_CallbackQueue[m_CallbackQueueStart];
+            ++count;
+
+            m_CallbackQueueStart = (m_CallbackQueueStart + 1) % m_CallbackQueue.size();
+            --m_CallbackQueueSize;
+        }
+
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setCallbackQueueCapacity(unsigned int capacity)
+    {
+        // Never drop callbacks that are still waiting in the queue
+        if (capacity < m_CallbackQueueSize)
+            capacity = m_CallbackQueueSize;
+
+        if (capacity == m_CallbackQueue.size())
+            return;
+
+        // Copy the queued callbacks to the front of the new buffer
+        std::vector<Callback> queue(capacity);
+        for (unsigned int i = 0; i < m_CallbackQueueSize; ++i)
+            queue[i] = m_CallbackQueue[(m_CallbackQueueStart + i) % m_CallbackQueue.size()];
+
+        m_CallbackQueue.swap(queue);
+        m_CallbackQueueStart = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getCallbackQueueCapacity() const
+    {
+        return m_CallbackQueue.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getCallbackQueueHighWatermark() const
+    {
+        return m_CallbackQueueHighWatermark;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::resetCallbackQueueHighWatermark()
+    {
+        m_CallbackQueueHighWatermark = m_CallbackQueueSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Gui::hasFocus() const
     {
         return m_Container.m_Focused;
@@ -272,7 +679,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<sf::String>& Gui::getWidgetNames()
+    const std::vector<sf::String>& Gui::getWidgetNames() const
     {
         return m_Container.getWidgetNames();
     }
@@ -293,6 +700,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Gui::getByPath(const sf::String& path) const
+    {
+        return m_Container.getByPath(path);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setTreeNameIndexEnabled(bool enabled)
+    {
+        m_Container.setTreeNameIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Gui::copy(const Widget::Ptr& oldWidget, const sf::String& newWidgetName)
     {
         return m_Container.copy(oldWidget, newWidgetName);
@@ -307,6 +728,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::remove(const std::vector<Widget::Ptr>& widgets)
+    {
+        m_Container.remove(widgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::removeAllWidgets()
     {
         m_Container.removeAllWidgets();
@@ -314,6 +742,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setWidgetArenaEnabled(bool enabled)
+    {
+        m_Container.setWidgetArenaEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isWidgetArenaEnabled() const
+    {
+        return m_Container.isWidgetArenaEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Gui::setWidgetName(const Widget::Ptr& widget, const std::string& name)
     {
         return m_Container.setWidgetName(widget, name);
@@ -415,8 +857,16 @@ namespace tgui
 
     void Gui::addChildCallback(const Callback& callback)
     {
-        // Add the callback to the queue
-        m_Callback.push(callback);
+        // Make the queue larger when it is full, callbacks are never dropped
+        if (m_CallbackQueueSize == m_CallbackQueue.size())
+            setCallbackQueueCapacity(std::max<unsigned int>(32, m_CallbackQueue.size() * 2));
+
+        // Add the callback to the queue, reusing the memory of the callback that was stored in the slot before
+        m_CallbackQueue[(m_CallbackQueueStart + m_CallbackQueueSize) % m_CallbackQueue.size()] = callback;
+        ++m_CallbackQueueSize;
+
+        if (m_CallbackQueueSize > m_CallbackQueueHighWatermark)
+            m_CallbackQueueHighWatermark = m_CallbackQueueSize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
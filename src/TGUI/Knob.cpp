@@ -112,6 +112,8 @@ namespace tgui
 
     bool Knob::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_loadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -129,10 +131,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("Knob", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("Knob");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_loadedConfigFile + ".");
             return false;
@@ -148,10 +149,10 @@ namespace tgui
             configFileFolder = m_loadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "backgroundimage")
             {
@@ -171,7 +172,7 @@ namespace tgui
             }
             else if (property == "imagerotation")
             {
-                m_imageRotation = static_cast<float>(atof(value.c_str()));
+                m_imageRotation = static_cast<float>(atof(value.string.c_str()));
             }
             else
                 TGUI_OUTPUT("TGUI warning: Unrecognized property '" + property + "' in section Knob in " + m_loadedConfigFile + ".");
@@ -218,6 +219,8 @@ namespace tgui
 
     void Knob::setSize(float width, float height)
     {
+        appearanceChanged();
+
         // Don't do anything when the knob wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -257,6 +260,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -272,6 +277,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -294,6 +301,8 @@ namespace tgui
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -319,6 +328,8 @@ namespace tgui
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,13 +351,15 @@ namespace tgui
             recalculateRotation();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_value);
                 addCallback();
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,6 +391,8 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -662,7 +677,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isOnlyBoundToParent(ValueChanged))
                 callbacks.push_back("ValueChanged");
 
             encodeList(callbacks, value);
@@ -741,8 +756,8 @@ namespace tgui
 
     void Knob::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_backgroundTexture, states);
-        target.draw(m_foregroundTexture, states);
+        RenderBatch::draw(target, m_backgroundTexture, states);
+        RenderBatch::draw(target, m_foregroundTexture, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
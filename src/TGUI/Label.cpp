@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Container.hpp>
 #include <TGUI/Label.hpp>
 
@@ -62,6 +60,8 @@ namespace tgui
 
     bool Label::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         // Don't continue when the config file was empty
         if (configFileFilename.empty())
             return true;
@@ -76,10 +76,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("Label", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("Label");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -89,14 +88,14 @@ namespace tgui
         configFile.close();
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "textcolor")
             {
-                setTextColor(extractColor(value));
+                setTextColor(configFile.readColor(value));
             }
             else
                 TGUI_OUTPUT("TGUI warning: Unrecognized property '" + property + "' in section Label in " + m_LoadedConfigFile + ".");
@@ -123,6 +122,7 @@ namespace tgui
         // Change the size of the label
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         m_Background.setSize(m_Size);
 
@@ -152,8 +152,11 @@ namespace tgui
         if (m_AutoSize)
         {
             m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
+            boundsChanged();
             m_Background.setSize(m_Size);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,6 +172,8 @@ namespace tgui
     {
         m_Text.setFont(font);
         setText(getText());
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +188,7 @@ namespace tgui
     void Label::setTextColor(const sf::Color& color)
     {
         m_Text.setColor(color);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -197,6 +203,7 @@ namespace tgui
     void Label::setTextStyle(sf::Uint32 style)
     {
         m_Text.setStyle(style);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -218,8 +225,11 @@ namespace tgui
         if (m_AutoSize)
         {
             m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
+            boundsChanged();
             m_Background.setSize(m_Size);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +244,7 @@ namespace tgui
     void Label::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_Background.setFillColor(backgroundColor);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -253,8 +264,11 @@ namespace tgui
         if (m_AutoSize)
         {
             m_Size = sf::Vector2f(m_Text.getLocalBounds().width, m_Text.getLocalBounds().height);
+            boundsChanged();
             m_Background.setSize(m_Size);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,53 +381,30 @@ namespace tgui
         {
             // Draw the background
             if (m_Background.getFillColor() != sf::Color::Transparent)
-                target.draw(m_Background, states);
+                RenderBatch::draw(target, m_Background, states);
 
             // Draw the text
-            target.draw(m_Text, states);
+            RenderBatch::draw(target, m_Text, states);
         }
         else
         {
-            const sf::View& view = target.getView();
-
-            // Calculate the scale factor of the view
-            float scaleViewX = target.getSize().x / view.getSize().x;
-            float scaleViewY = target.getSize().y / view.getSize().y;
-
-            // Get the global position
-            sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                        ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-            sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                            (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
-            // Get the old clipping area
-            GLint scissor[4];
-            glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-            // Calculate the clipping area
-            GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-            GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-            GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-            GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-            // If the object outside the window then don't draw anything
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            else if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
+            // When drawn without gui, nobody has started clipping yet
+            ClipStack clipStack;
+            clipStack.beginIfInactive(target);
 
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            // Don't draw outside the label
+            ClipStack::push(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y, m_Size.x, m_Size.y));
 
             // Draw the background
             if (m_Background.getFillColor() != sf::Color::Transparent)
-                target.draw(m_Background, states);
+                RenderBatch::draw(target, m_Background, states);
 
             // Draw the text
-            target.draw(m_Text, states);
+            RenderBatch::draw(target, m_Text, states);
 
             // Reset the old clipping area
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            ClipStack::pop(target);
+            clipStack.end();
         }
     }
 
@@ -26,8 +26,6 @@
 #include <cmath>
 #include <algorithm>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/ListBox.hpp>
@@ -59,6 +57,7 @@ namespace tgui
     ListBox::ListBox(const ListBox& copy) :
     Widget                   (copy),
     WidgetBorders            (copy),
+    onItemSelected           (copy.onItemSelected),
     m_LoadedConfigFile       (copy.m_LoadedConfigFile),
     m_Items                  (copy.m_Items),
     m_ItemIds                (copy.m_ItemIds),
@@ -106,6 +105,7 @@ namespace tgui
                 m_Scroll = nullptr;
             }
 
+            std::swap(onItemSelected,            temp.onItemSelected);
             std::swap(m_LoadedConfigFile,        temp.m_LoadedConfigFile);
             std::swap(m_Items,                   temp.m_Items);
             std::swap(m_ItemIds,                 temp.m_ItemIds);
@@ -137,6 +137,8 @@ namespace tgui
 
     bool ListBox::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // If there already was a scrollbar then delete it now
@@ -154,10 +156,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("ListBox", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("ListBox");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -173,40 +174,40 @@ namespace tgui
             configFileFolder = configFileFilename.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "backgroundcolor")
             {
-                setBackgroundColor(extractColor(value));
+                setBackgroundColor(configFile.readColor(value));
             }
             else if (property == "textcolor")
             {
-                setTextColor(extractColor(value));
+                setTextColor(configFile.readColor(value));
             }
             else if (property == "selectedbackgroundcolor")
             {
-                setSelectedBackgroundColor(extractColor(value));
+                setSelectedBackgroundColor(configFile.readColor(value));
             }
             else if (property == "selectedtextcolor")
             {
-                setSelectedTextColor(extractColor(value));
+                setSelectedTextColor(configFile.readColor(value));
             }
             else if (property == "bordercolor")
             {
-                setBorderColor(extractColor(value));
+                setBorderColor(configFile.readColor(value));
             }
             else if (property == "borders")
             {
                 Borders borders;
-                if (extractBorders(value, borders))
+                if (configFile.readBorders(value, borders))
                     setBorders(borders.left, borders.top, borders.right, borders.bottom);
             }
             else if (property == "scrollbar")
             {
-                if ((value.length() < 3) || (value[0] != '"') || (value[value.length()-1] != '"'))
+                if ((value.string.length() < 3) || (value.string[0] != '"') || (value.string[value.string.length()-1] != '"'))
                 {
                     TGUI_OUTPUT("TGUI error: Failed to parse value for Scrollbar in section ChatBox in " + m_LoadedConfigFile + ".");
                     return false;
@@ -214,7 +215,7 @@ namespace tgui
 
                 // load the scrollbar and check if it failed
                 m_Scroll = new Scrollbar();
-                if (m_Scroll->load(configFileFolder + value.substr(1, value.length()-2)) == false)
+                if (m_Scroll->load(configFileFolder + value.string.substr(1, value.string.length()-2)) == false)
                 {
                     // The scrollbar couldn't be loaded so it must be deleted
                     delete m_Scroll;
@@ -273,6 +274,8 @@ namespace tgui
             m_Scroll->setSize(m_Scroll->getSize().x, static_cast<float>(m_Size.y));
             m_Scroll->setLowValue(m_Size.y);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,6 +304,8 @@ namespace tgui
         m_SelectedBackgroundColor = selectedBackgroundColor;
         m_SelectedTextColor       = selectedTextColor;
         m_BorderColor             = borderColor;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -308,6 +313,7 @@ namespace tgui
     void ListBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,6 +321,7 @@ namespace tgui
     void ListBox::setTextColor(const sf::Color& textColor)
     {
         m_TextColor = textColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +329,7 @@ namespace tgui
     void ListBox::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
         m_SelectedBackgroundColor = selectedBackgroundColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +337,7 @@ namespace tgui
     void ListBox::setSelectedTextColor(const sf::Color& selectedTextColor)
     {
         m_SelectedTextColor = selectedTextColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -336,6 +345,7 @@ namespace tgui
     void ListBox::setBorderColor(const sf::Color& borderColor)
     {
         m_BorderColor = borderColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,6 +388,7 @@ namespace tgui
     void ListBox::setTextFont(const sf::Font& font)
     {
         m_TextFont = &font;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -391,6 +402,8 @@ namespace tgui
 
     int ListBox::addItem(const sf::String& itemName, int id)
     {
+        appearanceChanged();
+
         // Check if the item limit is reached (if there is one)
         if ((m_MaxItems == 0) || (m_Items.size() < m_MaxItems))
         {
@@ -424,6 +437,8 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
+        appearanceChanged();
+
         // Loop through all items
         for (unsigned int i = 0; i < m_Items.size(); ++i)
         {
@@ -457,6 +472,8 @@ namespace tgui
 
     bool ListBox::setSelectedItem(int index)
     {
+        appearanceChanged();
+
         if (index < 0)
         {
             deselectItem();
@@ -491,12 +508,15 @@ namespace tgui
     void ListBox::deselectItem()
     {
         m_SelectedItem = -1;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::removeItem(unsigned int index)
     {
+        appearanceChanged();
+
         // The index can't be too high
         if (index > m_Items.size()-1)
         {
@@ -525,6 +545,8 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
+        appearanceChanged();
+
         // Loop through all items
         for (unsigned int i = 0; i < m_Items.size(); ++i)
         {
@@ -556,6 +578,8 @@ namespace tgui
 
     unsigned int ListBox::removeItemsById(int id)
     {
+        appearanceChanged();
+
         unsigned int removedItems = 0;
 
         for (unsigned int i = 0; i < m_Items.size();)
@@ -588,6 +612,8 @@ namespace tgui
         // If there is a scrollbar then tell it that all item were removed
         if (m_Scroll != nullptr)
             m_Scroll->setMaximum(0);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -660,6 +686,8 @@ namespace tgui
 
     bool ListBox::changeItem(unsigned int index, const sf::String& newValue)
     {
+        appearanceChanged();
+
         if (index >= m_Items.size()) {
             return false;
         }
@@ -672,6 +700,8 @@ namespace tgui
 
     unsigned int ListBox::changeItems(const sf::String& originalValue, const sf::String& newValue)
     {
+        appearanceChanged();
+
         unsigned int amountChanged = 0;
         for (auto it = m_Items.begin(); it != m_Items.end(); ++it)
         {
@@ -689,6 +719,8 @@ namespace tgui
 
     unsigned int ListBox::changeItemsById(int id, const sf::String& newValue)
     {
+        appearanceChanged();
+
         unsigned int amountChanged = 0;
         auto idIt = m_ItemIds.begin();
         for (auto it = m_Items.begin(); it != m_Items.end(); ++it, ++idIt)
@@ -707,6 +739,8 @@ namespace tgui
 
     bool ListBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        appearanceChanged();
+
         // Calling setScrollbar with an empty string does the same as removeScrollbar
         if (scrollbarConfigFileFilename.empty() == true)
         {
@@ -758,6 +792,8 @@ namespace tgui
             m_Items.erase(m_Items.begin() + m_MaxItems, m_Items.end());
             m_ItemIds.erase(m_ItemIds.begin() + m_MaxItems, m_ItemIds.end());
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -791,6 +827,8 @@ namespace tgui
             // Set the maximum of the scrollbar
             m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -818,6 +856,8 @@ namespace tgui
             if (m_Scroll != nullptr)
                 m_Scroll->setMaximum(m_Items.size() * m_ItemHeight);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -835,6 +875,8 @@ namespace tgui
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
         m_BottomBorder = bottomBorder;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -941,18 +983,32 @@ namespace tgui
                     m_SelectedItem = -1;
             }
 
-            // Add the callback (if the user requested it)
-            if ((oldSelectedItem != m_SelectedItem) && (m_CallbackFunctions[ItemSelected].empty() == false))
+            if (oldSelectedItem != m_SelectedItem)
             {
-                // When no item is selected then send an empty string, otherwise send the item
-                if (m_SelectedItem < 0)
-                    m_Callback.text  = "";
-                else
-                    m_Callback.text = m_Items[m_SelectedItem];
+                // Send the signal (when no item is selected then send an empty string, otherwise send the item)
+                if (!onItemSelected.isEmpty())
+                {
+                    if (m_SelectedItem < 0)
+                        onItemSelected(sf::String(), m_SelectedItem);
+                    else
+                        onItemSelected(m_Items[m_SelectedItem], m_SelectedItem);
+                }
+
+                // Add the callback (if the user requested it)
+                if (isCallbackBound(ItemSelected))
+                {
+                    if (isCallbackDataNeeded(ItemSelected))
+                    {
+                        if (m_SelectedItem < 0)
+                            m_Callback.text  = "";
+                        else
+                            m_Callback.text = m_Items[m_SelectedItem];
+                    }
 
-                m_Callback.value   = m_SelectedItem;
-                m_Callback.trigger = ItemSelected;
-                addCallback();
+                    m_Callback.value   = m_SelectedItem;
+                    m_Callback.trigger = ItemSelected;
+                    addCallback();
+                }
             }
         }
     }
@@ -1013,6 +1069,8 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            const bool scrollHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + (m_Size.x - m_Scroll->getSize().x), getPosition().y);
 
@@ -1031,6 +1089,10 @@ namespace tgui
 
             // Reset the position
             m_Scroll->setPosition(0, 0);
+
+            // The scrollbar is not a child widget, so it can't tell itself that its hover state changed
+            if (m_Scroll->m_MouseHover != scrollHover)
+                appearanceChanged();
         }
     }
 
@@ -1203,7 +1265,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ItemSelected) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ItemSelected).size() == 1) && (m_CallbackFunctions.at(ItemSelected).front() == nullptr))
+            if (isOnlyBoundToParent(ItemSelected))
                 callbacks.push_back("ItemSelected");
 
             encodeList(callbacks, value);
@@ -1251,31 +1313,6 @@ namespace tgui
 
     void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition;
-        sf::Vector2f bottomRightPosition;
-
-        if ((m_Scroll != nullptr) && (m_Scroll->getLowValue() < m_Scroll->getMaximum()))
-        {
-            topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                           ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-            bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - m_Scroll->getSize().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                               (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-        }
-        else
-        {
-            topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                           ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-            bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                               (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-        }
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -1288,44 +1325,39 @@ namespace tgui
             sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y + m_TopBorder)));
             border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
             border.setFillColor(m_BorderColor);
-            target.draw(border, states);
+            RenderBatch::draw(target, border, states);
 
             // Draw top border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_RightBorder), static_cast<float>(m_TopBorder)));
             border.setPosition(0, -static_cast<float>(m_TopBorder));
-            target.draw(border, states);
+            RenderBatch::draw(target, border, states);
 
             // Draw right border
             border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y + m_BottomBorder)));
             border.setPosition(static_cast<float>(m_Size.x), 0);
-            target.draw(border, states);
+            RenderBatch::draw(target, border, states);
 
             // Draw bottom border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_LeftBorder), static_cast<float>(m_BottomBorder)));
             border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y));
-            target.draw(border, states);
+            RenderBatch::draw(target, border, states);
         }
 
         // Draw the background
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)));
         front.setFillColor(m_BackgroundColor);
-        target.draw(front, states);
+        RenderBatch::draw(target, front, states);
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
+        // The items can't be drawn on top of the borders or the scrollbar
+        sf::FloatRect clipArea(getAbsolutePosition().x, getAbsolutePosition().y, static_cast<float>(m_Size.x), static_cast<float>(m_Size.y));
+        if ((m_Scroll != nullptr) && (m_Scroll->getLowValue() < m_Scroll->getMaximum()))
+            clipArea.width -= m_Scroll->getSize().x;
 
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
+        // The items are also clipped when the list box is drawn without gui
+        ClipStack clipStack;
+        clipStack.beginIfInactive(target);
 
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        ClipStack::push(target, clipArea);
 
         // Create a text widget to draw the items
         sf::Text text("", *m_TextFont, m_TextSize);
@@ -1344,9 +1376,6 @@ namespace tgui
             if ((m_Scroll->getValue() + m_Scroll->getLowValue()) % m_ItemHeight != 0)
                 ++lastItem;
 
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
             for (unsigned int i = firstItem; i < lastItem; ++i)
             {
                 // Restore the transformations
@@ -1369,7 +1398,7 @@ namespace tgui
                         // Create and draw the background
                         sf::RectangleShape back(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_ItemHeight)));
                         back.setFillColor(m_SelectedBackgroundColor);
-                        target.draw(back, states);
+                        RenderBatch::draw(target, back, states);
 
                         // Restore the transformation
                         states.transform = storedTransform;
@@ -1385,14 +1414,11 @@ namespace tgui
                 states.transform.translate(2, std::floor(static_cast<float>(i * m_ItemHeight) - m_Scroll->getValue() + ((m_ItemHeight - bounds.height) / 2.0f) - bounds.top));
 
                 // Draw the text
-                target.draw(text, states);
+                RenderBatch::draw(target, text, states);
             }
         }
         else // There is no scrollbar or it is invisible
         {
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
             // Store the current transformations
             sf::Transform storedTransform = states.transform;
 
@@ -1415,7 +1441,7 @@ namespace tgui
                         // Create and draw the background
                         sf::RectangleShape back(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_ItemHeight)));
                         back.setFillColor(m_SelectedBackgroundColor);
-                        target.draw(back, states);
+                        RenderBatch::draw(target, back, states);
 
                         // Restore the transformation
                         states.transform = storedTransform;
@@ -1434,12 +1460,12 @@ namespace tgui
                 states.transform.translate(2, std::floor((i * m_ItemHeight) + ((m_ItemHeight - bounds.height) / 2.0f) - bounds.top));
 
                 // Draw the text
-                target.draw(text, states);
+                RenderBatch::draw(target, text, states);
             }
         }
 
-        // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        ClipStack::pop(target);
+        clipStack.end();
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -140,10 +140,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("LoadingBar", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("LoadingBar");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -159,10 +158,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "backimage")
             {
@@ -234,11 +233,11 @@ namespace tgui
             }
             else if (property == "textcolor")
             {
-                setTextColor(extractColor(value));
+                setTextColor(configFile.readColor(value));
             }
             else if (property == "textsize")
             {
-                setTextSize(atoi(value.c_str()));
+                setTextSize(atoi(value.string.c_str()));
             }
             else
                 TGUI_OUTPUT("TGUI warning: Unrecognized property '" + property + "' in section LoadingBar in " + m_LoadedConfigFile + ".");
@@ -253,9 +252,10 @@ namespace tgui
             {
                 m_Size.x = static_cast<float>(m_TextureBack_L.getSize().x + m_TextureBack_M.getSize().x + m_TextureBack_R.getSize().x);
                 m_Size.y = static_cast<float>(m_TextureBack_M.getSize().y);
+                boundsChanged();
 
-                m_TextureBack_M.data->texture.setRepeated(true);
-                m_TextureFront_M.data->texture.setRepeated(true);
+                m_TextureBack_M.setRepeated(true);
+                m_TextureFront_M.setRepeated(true);
             }
             else
             {
@@ -269,6 +269,7 @@ namespace tgui
             if ((m_TextureBack_M.data != nullptr) && (m_TextureFront_M.data != nullptr))
             {
                 m_Size = sf::Vector2f(m_TextureBack_M.getSize());
+                boundsChanged();
             }
             else
             {
@@ -308,6 +309,7 @@ namespace tgui
         // Set the size of the loading bar
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         if (m_SplitImage)
         {
@@ -340,6 +342,8 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -359,6 +363,8 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -376,19 +382,23 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateSize();
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int LoadingBar::incrementValue()
     {
+        appearanceChanged();
+
         // When the value is still below the maximum then adjust it
         if (m_Value < m_Maximum)
         {
             ++m_Value;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_Value);
@@ -399,7 +409,7 @@ namespace tgui
             if (m_Value == m_Maximum)
             {
                 // Add the callback (if the user requested it)
-                if (m_CallbackFunctions[LoadingBarFull].empty() == false)
+                if (isCallbackBound(LoadingBarFull))
                 {
                     m_Callback.trigger = LoadingBarFull;
                     m_Callback.value   = static_cast<int>(m_Value);
@@ -440,6 +450,8 @@ namespace tgui
 
     void LoadingBar::setText(const sf::String& text)
     {
+        appearanceChanged();
+
         // Don't do anything when the loading bar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -477,6 +489,7 @@ namespace tgui
     void LoadingBar::setTextFont(const sf::Font& font)
     {
         m_Text.setFont(font);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,6 +504,7 @@ namespace tgui
     void LoadingBar::setTextColor(const sf::Color& color)
     {
         m_Text.setColor(color);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -509,6 +523,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text.getString());
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -615,9 +631,9 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isOnlyBoundToParent(ValueChanged))
                 callbacks.push_back("ValueChanged");
-            if ((m_CallbackFunctions.find(LoadingBarFull) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LoadingBarFull).size() == 1) && (m_CallbackFunctions.at(LoadingBarFull).front() == nullptr))
+            if (isOnlyBoundToParent(LoadingBarFull))
                 callbacks.push_back("LoadingBarFull");
 
             encodeList(callbacks, value);
@@ -718,7 +734,7 @@ namespace tgui
             m_TextureFront_R.sprite.setTextureRect(bounds_R);
 
             // Make sure that the back image is displayed correctly
-            m_TextureBack_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(totalWidth - m_TextureBack_L.getSize().x - m_TextureBack_R.getSize().x), m_TextureBack_M.getSize().y));
+            m_TextureBack_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>(totalWidth - m_TextureBack_L.getSize().x - m_TextureBack_R.getSize().x), m_TextureBack_M.getSize().y));
         }
         else // The image is not split
         {
@@ -767,8 +783,8 @@ namespace tgui
             states.transform.scale(scalingY, scalingY);
 
             // Draw the left image of the loading bar
-            target.draw(m_TextureBack_L, states);
-            target.draw(m_TextureFront_L, states);
+            RenderBatch::draw(target, m_TextureBack_L, states);
+            RenderBatch::draw(target, m_TextureFront_L, states);
 
             // Check if the middle image may be drawn
             if ((scalingY * (m_TextureBack_L.getSize().x + m_TextureBack_R.getSize().x)) < m_Size.x)
@@ -777,15 +793,15 @@ namespace tgui
                 states.transform.translate(static_cast<float>(m_TextureBack_L.getSize().x), 0);
 
                 // Draw the middle image
-                target.draw(m_TextureBack_M, states);
-                target.draw(m_TextureFront_M, states);
+                RenderBatch::draw(target, m_TextureBack_M, states);
+                RenderBatch::draw(target, m_TextureFront_M, states);
 
                 // Put the right image on the correct position
                 states.transform.translate(m_TextureBack_M.sprite.getGlobalBounds().width, 0);
 
                 // Draw the right image
-                target.draw(m_TextureBack_R, states);
-                target.draw(m_TextureFront_R, states);
+                RenderBatch::draw(target, m_TextureBack_R, states);
+                RenderBatch::draw(target, m_TextureFront_R, states);
             }
             else // The loading bar isn't width enough, we will draw it at minimum size
             {
@@ -793,8 +809,8 @@ namespace tgui
                 states.transform.translate(static_cast<float>(m_TextureBack_L.getSize().x), 0);
 
                 // Draw the right image
-                target.draw(m_TextureBack_R, states);
-                target.draw(m_TextureFront_R, states);
+                RenderBatch::draw(target, m_TextureBack_R, states);
+                RenderBatch::draw(target, m_TextureFront_R, states);
             }
         }
         else // The image is not split
@@ -803,8 +819,8 @@ namespace tgui
             states.transform.scale(m_Size.x / m_TextureBack_M.getSize().x, m_Size.y / m_TextureBack_M.getSize().y);
 
             // Draw the loading bar
-            target.draw(m_TextureBack_M, states);
-            target.draw(m_TextureFront_M, states);
+            RenderBatch::draw(target, m_TextureBack_M, states);
+            RenderBatch::draw(target, m_TextureFront_M, states);
         }
 
         // Check if there is a text to draw
@@ -824,7 +840,7 @@ namespace tgui
             states.transform.translate(std::floor(rect.left + 0.5f), std::floor(rect.top + 0.5f));
 
             // Draw the text
-            target.draw(m_Text, states);
+            RenderBatch::draw(target, m_Text, states);
         }
     }
 
@@ -62,6 +62,8 @@ namespace tgui
 
     bool MenuBar::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // Open the config file
@@ -72,10 +74,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("MenuBar", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("MenuBar");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -85,30 +86,30 @@ namespace tgui
         configFile.close();
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "backgroundcolor")
             {
-                setBackgroundColor(extractColor(value));
+                setBackgroundColor(configFile.readColor(value));
             }
             else if (property == "textcolor")
             {
-                setTextColor(extractColor(value));
+                setTextColor(configFile.readColor(value));
             }
             else if (property == "selectedbackgroundcolor")
             {
-                setSelectedBackgroundColor(extractColor(value));
+                setSelectedBackgroundColor(configFile.readColor(value));
             }
             else if (property == "selectedtextcolor")
             {
-                setSelectedTextColor(extractColor(value));
+                setSelectedTextColor(configFile.readColor(value));
             }
             else if (property == "distancetoside")
             {
-                setDistanceToSide(static_cast<unsigned int>(atoi(value.c_str())));
+                setDistanceToSide(static_cast<unsigned int>(atoi(value.string.c_str())));
             }
             else
                 TGUI_OUTPUT("TGUI warning: Unrecognized property '" + property + "' in section MenuBar in " + m_LoadedConfigFile + ".");
@@ -136,6 +137,8 @@ namespace tgui
             m_Size.y = 10;
 
         setTextSize(static_cast<unsigned int>(height * 0.75f));
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,12 +162,16 @@ namespace tgui
         menu.text.setCharacterSize(m_TextSize);
 
         m_Menus.push_back(menu);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool MenuBar::addMenuItem(const sf::String& menu, const sf::String& text)
     {
+        appearanceChanged();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -190,6 +197,8 @@ namespace tgui
 
     bool MenuBar::removeMenu(const sf::String& menu)
     {
+        appearanceChanged();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -214,6 +223,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const sf::String& menu, const sf::String& menuItem)
     {
+        appearanceChanged();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_Menus.size(); ++i)
         {
@@ -246,6 +257,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_Menus.clear();
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,6 +282,8 @@ namespace tgui
 
             m_Menus[i].text.setColor(textColor);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,6 +291,7 @@ namespace tgui
     void MenuBar::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -295,6 +310,8 @@ namespace tgui
 
             m_Menus[i].text.setColor(textColor);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,6 +319,7 @@ namespace tgui
     void MenuBar::setSelectedBackgroundColor(const sf::Color& selectedBackgroundColor)
     {
         m_SelectedBackgroundColor = selectedBackgroundColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,6 +333,8 @@ namespace tgui
             if (m_Menus[m_VisibleMenu].selectedMenuItem != -1)
                 m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(selectedTextColor);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -362,6 +382,8 @@ namespace tgui
         }
 
         setTextSize(m_TextSize);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -384,6 +406,8 @@ namespace tgui
 
             m_Menus[i].text.setCharacterSize(m_TextSize);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,6 +422,7 @@ namespace tgui
     void MenuBar::setDistanceToSide(unsigned int distanceToSide)
     {
         m_DistanceToSide = distanceToSide;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -412,6 +437,7 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(unsigned int minimumWidth)
     {
         m_MinimumSubMenuWidth = minimumWidth;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -517,10 +543,14 @@ namespace tgui
 
                 if (selectedMenuItem < m_Menus[m_VisibleMenu].menuItems.size())
                 {
-                    if (m_CallbackFunctions[MenuItemClicked].empty() == false)
+                    onMenuItemClicked(m_Menus[m_VisibleMenu].menuItems[selectedMenuItem].getString(), static_cast<unsigned int>(m_VisibleMenu));
+
+                    if (isCallbackBound(MenuItemClicked))
                     {
                         m_Callback.trigger = MenuItemClicked;
-                        m_Callback.text = m_Menus[m_VisibleMenu].menuItems[selectedMenuItem].getString();
+                        if (isCallbackDataNeeded(MenuItemClicked))
+                            m_Callback.text = m_Menus[m_VisibleMenu].menuItems[selectedMenuItem].getString();
+
                         m_Callback.index = m_VisibleMenu;
                         addCallback();
                     }
@@ -549,6 +579,10 @@ namespace tgui
 
         m_MouseHover = true;
 
+        // Remember what was shown, so that the menu bar is only redrawn when another menu or menu item is selected
+        const int oldVisibleMenu = m_VisibleMenu;
+        const int oldSelectedMenuItem = (m_VisibleMenu != -1) ? m_Menus[m_VisibleMenu].selectedMenuItem : -1;
+
         // Check if the mouse is on top of the menu bar (not on an open menus)
         if (y <= m_Size.y + getPosition().y)
         {
@@ -613,6 +647,9 @@ namespace tgui
                 m_Menus[m_VisibleMenu].menuItems[m_Menus[m_VisibleMenu].selectedMenuItem].setColor(m_SelectedTextColor);
             }
         }
+
+        if ((m_VisibleMenu != oldVisibleMenu) || ((m_VisibleMenu != -1) && (m_Menus[m_VisibleMenu].selectedMenuItem != oldSelectedMenuItem)))
+            appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -630,6 +667,7 @@ namespace tgui
             }
 
             m_VisibleMenu = -1;
+            appearanceChanged();
         }
     }
 
@@ -768,7 +806,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(MenuItemClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MenuItemClicked).size() == 1) && (m_CallbackFunctions.at(MenuItemClicked).front() == nullptr))
+            if (isOnlyBoundToParent(MenuItemClicked))
                 callbacks.push_back("MenuItemClicked");
 
             encodeList(callbacks, value);
@@ -820,7 +858,7 @@ namespace tgui
         // Draw the background
         sf::RectangleShape background(m_Size);
         background.setFillColor(m_BackgroundColor);
-        target.draw(background, states);
+        RenderBatch::draw(target, background, states);
 
         if (m_Menus.empty())
             return;
@@ -837,7 +875,7 @@ namespace tgui
         {
             states.transform.translate(static_cast<float>(m_DistanceToSide), 0);
             states.transform.translate(textShift.x, textShift.y);
-            target.draw(m_Menus[i].text, states);
+            RenderBatch::draw(target, m_Menus[i].text, states);
             states.transform.translate(-textShift.x, -textShift.y);
 
             // Is the menu open?
@@ -860,7 +898,7 @@ namespace tgui
                 // Draw the background of the menu
                 background = sf::RectangleShape(sf::Vector2f(menuWidth, m_Size.y * m_Menus[i].menuItems.size()));
                 background.setFillColor(m_BackgroundColor);
-                target.draw(background, states);
+                RenderBatch::draw(target, background, states);
 
                 // If there is a selected menu item then draw its background
                 if (m_Menus[i].selectedMenuItem != -1)
@@ -868,7 +906,7 @@ namespace tgui
                     states.transform.translate(0, m_Menus[i].selectedMenuItem * m_Size.y);
                     background = sf::RectangleShape(sf::Vector2f(menuWidth, m_Size.y));
                     background.setFillColor(m_SelectedBackgroundColor);
-                    target.draw(background, states);
+                    RenderBatch::draw(target, background, states);
                     states.transform.translate(0, m_Menus[i].selectedMenuItem * -m_Size.y);
                 }
 
@@ -878,7 +916,7 @@ namespace tgui
                 // Draw the menu items
                 for (unsigned int j = 0; j < m_Menus[i].menuItems.size(); ++j)
                 {
-                    target.draw(m_Menus[i].menuItems[j], states);
+                    RenderBatch::draw(target, m_Menus[i].menuItems[j], states);
 
                     states.transform.translate(0, m_Size.y);
                 }
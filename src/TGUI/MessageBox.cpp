@@ -97,6 +97,8 @@ namespace tgui
 
     bool MessageBox::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -110,10 +112,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("MessageBox", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("MessageBox");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -132,10 +133,10 @@ namespace tgui
         bool buttonPropertyFound = false;
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "textcolor")
             {
@@ -143,13 +144,13 @@ namespace tgui
             }
             else if (property == "childwindow")
             {
-                if ((value.length() < 3) || (value[0] != '"') || (value[value.length()-1] != '"'))
+                if ((value.string.length() < 3) || (value.string[0] != '"') || (value.string[value.string.length()-1] != '"'))
                 {
                     TGUI_OUTPUT("TGUI error: Failed to parse value for ChildWindow in section MessageBox in " + m_LoadedConfigFile + ".");
                     return false;
                 }
 
-                if (!ChildWindow::load(configFileFolder + value.substr(1, value.length()-2)))
+                if (!ChildWindow::load(configFileFolder + value.string.substr(1, value.string.length()-2)))
                 {
                     TGUI_OUTPUT("TGUI error: Failed to load the internal ChildWindow for MessageBox.");
                 }
@@ -158,13 +159,13 @@ namespace tgui
             }
             else if (property == "button")
             {
-                if ((value.length() < 3) || (value[0] != '"') || (value[value.length()-1] != '"'))
+                if ((value.string.length() < 3) || (value.string[0] != '"') || (value.string[value.string.length()-1] != '"'))
                 {
                     TGUI_OUTPUT("TGUI error: Failed to parse value for Button in section MessageBox in " + m_LoadedConfigFile + ".");
                     return false;
                 }
 
-                m_ButtonConfigFileFilename = configFileFolder + value.substr(1, value.length()-2);
+                m_ButtonConfigFileFilename = configFileFolder + value.string.substr(1, value.string.length()-2);
                 buttonPropertyFound = true;
             }
             else
@@ -201,6 +202,8 @@ namespace tgui
         {
             TGUI_OUTPUT("TGUI error: Failed to set the text. MessageBox was not loaded completely.");
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,6 +224,7 @@ namespace tgui
     void MessageBox::setTextFont(const sf::Font& font)
     {
         m_Label->setTextFont(font);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,6 +239,7 @@ namespace tgui
     void MessageBox::setTextColor(const sf::Color& color)
     {
         m_Label->setTextColor(color);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,6 +264,8 @@ namespace tgui
 
             rearrange();
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -288,6 +295,8 @@ namespace tgui
         {
             TGUI_OUTPUT("TGUI error: Could not add a button. MessageBox was not loaded completely.");
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,7 +376,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ButtonClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ButtonClicked).size() == 1) && (m_CallbackFunctions.at(ButtonClicked).front() == nullptr))
+            if (isOnlyBoundToParent(ButtonClicked))
                 callbacks.push_back("ButtonClicked");
 
             encodeList(callbacks, value);
@@ -451,7 +460,7 @@ namespace tgui
 
     void MessageBox::ButtonClickedCallbackFunction(const Callback& callback)
     {
-        if (m_CallbackFunctions[ButtonClicked].empty() == false)
+        if (isCallbackBound(ButtonClicked))
         {
             m_Callback.trigger = ButtonClicked;
             m_Callback.text    = static_cast<Button*>(callback.widget)->getText();
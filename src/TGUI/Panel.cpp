@@ -23,8 +23,6 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Panel.hpp>
 
@@ -102,6 +100,7 @@ namespace tgui
         // Set the size of the panel
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         // If there is a background texture then resize it
         if (m_Texture)
@@ -128,6 +127,8 @@ namespace tgui
             m_Sprite.setTexture(*m_Texture, true);
             m_Sprite.setScale(m_Size.x / m_Texture->getSize().x, m_Size.y / m_Texture->getSize().y);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +143,7 @@ namespace tgui
     void Panel::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,9 +178,8 @@ namespace tgui
         {
             mouseLeftWidget();
 
-            // Tell the widgets inside the panel that the mouse is no longer on top of them
-            for (unsigned int i = 0; i < m_Widgets.size(); ++i)
-                m_Widgets[i]->mouseNotOnWidget();
+            // Tell the widget below the mouse that the mouse is no longer on top of it
+            setHoveredWidget(nullptr);
 
             m_MouseHover = false;
         }
@@ -188,13 +189,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Panel::getMouseBounds(sf::FloatRect& bounds) const
+    {
+        bounds = getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x, m_Size.y));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Panel::getDrawBounds(sf::FloatRect& bounds) const
+    {
+        // The contents of the panel are clipped, so nothing is drawn outside the mouse bounds
+        return getMouseBounds(bounds);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Panel::leftMousePressed(float x, float y)
     {
         if (mouseOnWidget(x, y))
         {
             m_MouseDown = true;
 
-            if (!m_CallbackFunctions[LeftMousePressed].empty())
+            if (isCallbackBound(LeftMousePressed))
             {
                 m_Callback.trigger = LeftMousePressed;
                 m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -212,7 +229,7 @@ namespace tgui
     {
         if (mouseOnWidget(x, y))
         {
-            if (!m_CallbackFunctions[LeftMouseReleased].empty())
+            if (isCallbackBound(LeftMouseReleased))
             {
                 m_Callback.trigger = LeftMouseReleased;
                 m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -222,7 +239,7 @@ namespace tgui
 
             if (m_MouseDown)
             {
-                if (!m_CallbackFunctions[LeftMouseClicked].empty())
+                if (isCallbackBound(LeftMouseClicked))
                 {
                     m_Callback.trigger = LeftMouseClicked;
                     m_Callback.mouse.x = static_cast<int>(x - getPosition().x);
@@ -295,11 +312,11 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(LeftMousePressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMousePressed).size() == 1) && (m_CallbackFunctions.at(LeftMousePressed).front() == nullptr))
+            if (isOnlyBoundToParent(LeftMousePressed))
                 callbacks.push_back("LeftMousePressed");
-            if ((m_CallbackFunctions.find(LeftMouseReleased) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseReleased).size() == 1) && (m_CallbackFunctions.at(LeftMouseReleased).front() == nullptr))
+            if (isOnlyBoundToParent(LeftMouseReleased))
                 callbacks.push_back("LeftMouseReleased");
-            if ((m_CallbackFunctions.find(LeftMouseClicked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(LeftMouseClicked).size() == 1) && (m_CallbackFunctions.at(LeftMouseClicked).front() == nullptr))
+            if (isOnlyBoundToParent(LeftMouseClicked))
                 callbacks.push_back("LeftMouseClicked");
 
             encodeList(callbacks, value);
@@ -327,42 +344,62 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Panel::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    bool Panel::updateRenderCaches()
     {
-        // Don't draw when the texture wasn't created
-        if (m_Loaded == false)
-            return;
+        bool rendered = Container::updateRenderCaches();
 
-        const sf::View& view = target.getView();
+        if (!m_RenderCacheEnabled || m_RenderCacheValid || (m_Loaded == false))
+            return rendered;
 
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
+        sf::RenderTarget* target = beginRenderCache(getAbsolutePosition(), m_Size);
+        if (target == nullptr)
+            return rendered;
 
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
+        sf::RenderStates states;
+        states.transform.translate(getAbsolutePosition());
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
+        if (m_BackgroundColor != sf::Color::Transparent)
+        {
+            sf::RectangleShape background(m_Size);
+            background.setFillColor(m_BackgroundColor);
+            target->draw(background, states);
+        }
+
+        if (m_Texture)
+            target->draw(m_Sprite, states);
+
+        // The texture has its own clipping area, which is unrelated to the one of the gui
+        ClipStack clipStack;
+        clipStack.begin(*target);
+        drawWidgetContainer(target, states);
+        clipStack.end();
+
+        endRenderCache();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
+    void Panel::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        // Don't draw when the texture wasn't created
+        if (m_Loaded == false)
+            return;
+
+        // When the contents are cached then only the cached image has to be drawn
+        if (m_RenderCacheEnabled && m_RenderCacheValid)
+        {
+            states.transform *= getTransform();
+            RenderBatch::draw(target, sf::Sprite(m_RenderCache->getTexture()), states);
+            return;
+        }
 
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        // A panel that is drawn without gui has to start clipping itself
+        ClipStack clipStack;
+        clipStack.beginIfInactive(target);
 
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // Don't draw outside the panel
+        ClipStack::push(target, sf::FloatRect(getAbsolutePosition().x, getAbsolutePosition().y, m_Size.x, m_Size.y));
 
         // Set the transform
         states.transform *= getTransform();
@@ -372,18 +409,18 @@ namespace tgui
         {
             sf::RectangleShape background(m_Size);
             background.setFillColor(m_BackgroundColor);
-            target.draw(background, states);
+            RenderBatch::draw(target, background, states);
         }
 
         // Draw the background texture if there is one
         if (m_Texture)
-            target.draw(m_Sprite, states);
+            RenderBatch::draw(target, m_Sprite, states);
 
         // Draw the widgets
         drawWidgetContainer(&target, states);
 
-        // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        ClipStack::pop(target);
+        clipStack.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,6 +88,8 @@ namespace tgui
 
     bool Picture::load(const std::string& filename)
     {
+        appearanceChanged();
+
         // When everything is loaded successfully, this will become true.
         m_Loaded = false;
         m_Size.x = 0;
@@ -132,13 +134,16 @@ namespace tgui
             TGUI_TextureManager.removeTexture(m_Texture);
 
         m_Texture.data = new TextureData();
-        m_Texture.data->texture = texture;
-        m_Texture.data->rect = sf::IntRect(0, 0, m_Texture.getSize().x, m_Texture.getSize().y);
+        m_Texture.data->ownTexture = texture;
+        m_Texture.data->texture = &m_Texture.data->ownTexture;
+        m_Texture.data->rect = sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y);
         m_Texture.data->users = 1;
-        m_Texture.sprite.setTexture(m_Texture.data->texture, true);
+        m_Texture.sprite.setTexture(*m_Texture.data->texture, true);
 
         m_Loaded = true;
         setSize(static_cast<float>(m_Texture.getSize().x),static_cast<float>(m_Texture.getSize().y));
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +168,7 @@ namespace tgui
     {
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         if (m_Loaded)
             m_Texture.sprite.setScale(m_Size.x / m_Texture.getSize().x, m_Size.y / m_Texture.getSize().y);
@@ -175,9 +181,11 @@ namespace tgui
     void Picture::setSmooth(bool smooth)
     {
         if (m_Loaded)
-            m_Texture.data->texture.setSmooth(smooth);
+            m_Texture.setSmooth(smooth);
         else
             TGUI_OUTPUT("TGUI warning: Picture::setSmooth called while Picture wasn't loaded yet.");
+
+        appearanceChanged();
     }
 
 
@@ -186,7 +194,7 @@ namespace tgui
     bool Picture::isSmooth() const
     {
         if (m_Loaded)
-            return m_Texture.data->texture.isSmooth();
+            return m_Texture.isSmooth();
         else
         {
             TGUI_OUTPUT("TGUI warning: Picture::isSmooth called while Picture wasn't loaded yet.");
@@ -290,7 +298,7 @@ namespace tgui
 
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_Texture, states);
+        RenderBatch::draw(target, m_Texture, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,10 +123,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("RadioButton", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("RadioButton");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -142,10 +141,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "textcolor")
             {
@@ -192,6 +191,7 @@ namespace tgui
         {
             m_Loaded = true;
             m_Size = sf::Vector2f(m_TextureChecked.getSize());
+            boundsChanged();
         }
         else
         {
@@ -203,6 +203,7 @@ namespace tgui
         if (m_TextureFocused.data != nullptr)
         {
             m_AllowFocus = true;
+            focusableChanged();
             m_WidgetPhase |= WidgetPhase_Focused;
         }
         if (m_TextureHover.data != nullptr)
@@ -252,6 +253,7 @@ namespace tgui
         // Set the size of the radio button
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         // If the text is auto sized then recalculate the size
         if (m_TextSize == 0)
@@ -291,19 +293,22 @@ namespace tgui
         if (m_Checked == false)
         {
             // Tell our parent that all the radio buttons should be unchecked
-            m_Parent->uncheckRadioButtons();
+            if (m_Parent)
+                m_Parent->uncheckRadioButtons();
 
             // Check this radio button
             m_Checked = true;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Checked].empty() == false)
+            if (isCallbackBound(Checked))
             {
                 m_Callback.trigger = Checked;
                 m_Callback.checked = true;
                 addCallback();
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,13 +320,15 @@ namespace tgui
             m_Checked = false;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[Unchecked].empty() == false)
+            if (isCallbackBound(Unchecked))
             {
                 m_Callback.trigger = Unchecked;
                 m_Callback.checked = false;
                 addCallback();
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -335,6 +342,8 @@ namespace tgui
 
     void RadioButton::setText(const sf::String& text)
     {
+        appearanceChanged();
+
         // Don't do anything when the radio button wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -365,6 +374,8 @@ namespace tgui
     {
         m_Text.setFont(font);
         setText(getText());
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,6 +390,7 @@ namespace tgui
     void RadioButton::setTextColor(const sf::Color& Color)
     {
         m_Text.setColor(Color);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -397,6 +409,8 @@ namespace tgui
 
         // Call setText to reposition the text
         setText(m_Text.getString());
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,6 +425,7 @@ namespace tgui
     void RadioButton::allowTextClick(bool acceptTextClick)
     {
         m_AllowTextClick = acceptTextClick;
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -457,10 +472,43 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool RadioButton::getMouseBounds(sf::FloatRect& bounds) const
+    {
+        // The text lies outside the image, so the whole widget has to be checked when the text can be clicked
+        if (m_AllowTextClick)
+            return false;
+
+        bounds = getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x, m_Size.y));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RadioButton::getDrawBounds(sf::FloatRect& bounds) const
+    {
+        bounds = getTransform().transformRect(sf::FloatRect(0, 0, m_Size.x, m_Size.y));
+
+        // The text is drawn next to the image
+        if (m_Text.getString().isEmpty() == false)
+        {
+            const sf::FloatRect textBounds = m_Text.getGlobalBounds();
+            const float right = TGUI_MAXIMUM(bounds.left + bounds.width, textBounds.left + textBounds.width);
+            const float bottom = TGUI_MAXIMUM(bounds.top + bounds.height, textBounds.top + textBounds.height);
+            bounds.left = TGUI_MINIMUM(bounds.left, textBounds.left);
+            bounds.top = TGUI_MINIMUM(bounds.top, textBounds.top);
+            bounds.width = right - bounds.left;
+            bounds.height = bottom - bounds.top;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButton::leftMouseReleased(float x, float y)
     {
         // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[LeftMouseReleased].empty() == false)
+        if (isCallbackBound(LeftMouseReleased))
         {
             m_Callback.trigger = LeftMouseReleased;
             m_Callback.checked = m_Checked;
@@ -476,7 +524,7 @@ namespace tgui
             check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[LeftMouseClicked].empty() == false)
+            if (isCallbackBound(LeftMouseClicked))
             {
                 m_Callback.trigger = LeftMouseClicked;
                 m_Callback.checked = m_Checked;
@@ -500,7 +548,7 @@ namespace tgui
             check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[SpaceKeyPressed].empty() == false)
+            if (isCallbackBound(SpaceKeyPressed))
             {
                 m_Callback.trigger = SpaceKeyPressed;
                 m_Callback.checked = m_Checked;
@@ -513,7 +561,7 @@ namespace tgui
             check();
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ReturnKeyPressed].empty() == false)
+            if (isCallbackBound(ReturnKeyPressed))
             {
                 m_Callback.trigger = ReturnKeyPressed;
                 m_Callback.checked = m_Checked;
@@ -628,13 +676,13 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(Checked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Checked).size() == 1) && (m_CallbackFunctions.at(Checked).front() == nullptr))
+            if (isOnlyBoundToParent(Checked))
                 callbacks.push_back("Checked");
-            if ((m_CallbackFunctions.find(Unchecked) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Unchecked).size() == 1) && (m_CallbackFunctions.at(Unchecked).front() == nullptr))
+            if (isOnlyBoundToParent(Unchecked))
                 callbacks.push_back("Unchecked");
-            if ((m_CallbackFunctions.find(SpaceKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(SpaceKeyPressed).size() == 1) && (m_CallbackFunctions.at(SpaceKeyPressed).front() == nullptr))
+            if (isOnlyBoundToParent(SpaceKeyPressed))
                 callbacks.push_back("SpaceKeyPressed");
-            if ((m_CallbackFunctions.find(ReturnKeyPressed) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ReturnKeyPressed).size() == 1) && (m_CallbackFunctions.at(ReturnKeyPressed).front() == nullptr))
+            if (isOnlyBoundToParent(ReturnKeyPressed))
                 callbacks.push_back("ReturnKeyPressed");
 
             encodeList(callbacks, value);
@@ -678,20 +726,20 @@ namespace tgui
     void RadioButton::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_Checked)
-            target.draw(m_TextureChecked, states);
+            RenderBatch::draw(target, m_TextureChecked, states);
         else
-            target.draw(m_TextureUnchecked, states);
+            RenderBatch::draw(target, m_TextureUnchecked, states);
 
         // When the radio button is focused then draw an extra image
         if ((m_Focused) && (m_WidgetPhase & WidgetPhase_Focused))
-            target.draw(m_TextureFocused, states);
+            RenderBatch::draw(target, m_TextureFocused, states);
 
         // When the mouse is on top of the radio button then draw an extra image
         if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-            target.draw(m_TextureHover, states);
+            RenderBatch::draw(target, m_TextureHover, states);
 
         // Draw the text
-        target.draw(m_Text, states);
+        RenderBatch::draw(target, m_Text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,208 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RecordingTarget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    RecordingTarget::RecordingTarget(unsigned int width, unsigned int height) :
+        m_Size           (width, height),
+        m_ClipArea       (0, 0, static_cast<int>(width), static_cast<int>(height)),
+        m_VertexCount    (0),
+        m_TextureSwitches(0),
+        m_ClipChanges    (0)
+    {
+        initialize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u RecordingTarget::getSize() const
+    {
+        return m_Size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingTarget::beginFrame()
+    {
+        // The commands are cleared without releasing their memory, so that recording the next frame doesn't allocate
+        m_Commands.clear();
+
+        m_ClipArea = sf::IntRect(0, 0, static_cast<int>(m_Size.x), static_cast<int>(m_Size.y));
+        m_VertexCount = 0;
+        m_TextureSwitches = 0;
+        m_ClipChanges = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingTarget::record(const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        if (const sf::Sprite* sprite = dynamic_cast<const sf::Sprite*>(&drawable))
+        {
+            // A sprite without texture isn't drawn by SFML
+            if (sprite->getTexture() != nullptr)
+                addCommand(sf::Quads, 4, sprite->getTexture(), states.transform * sprite->getTransform());
+        }
+        else if (const sf::Text* text = dynamic_cast<const sf::Text*>(&drawable))
+        {
+            if (text->getFont() == nullptr)
+                return;
+
+            // Every visible character is a quad, underlined text gets an extra quad below every line
+            const bool underlined = (text->getStyle() & sf::Text::Underlined) != 0;
+            const sf::String& string = text->getString();
+
+            unsigned int quads = 0;
+            bool lineStarted = false;
+            for (std::size_t i = 0; i < string.getSize(); ++i)
+            {
+                const sf::Uint32 character = string[i];
+                if (character == L'\n')
+                {
+                    if (underlined)
+                        ++quads;
+
+                    lineStarted = false;
+                }
+                else if (character != L'\v')
+                {
+                    if ((character != L' ') && (character != L'\t'))
+                        ++quads;
+
+                    lineStarted = true;
+                }
+            }
+
+            if (underlined && lineStarted)
+                ++quads;
+
+            addCommand(sf::Quads, quads * 4, &text->getFont()->getTexture(text->getCharacterSize()), states.transform * text->getTransform());
+        }
+        else if (const sf::Shape* shape = dynamic_cast<const sf::Shape*>(&drawable))
+        {
+            const sf::Transform transform = states.transform * shape->getTransform();
+
+            // The inside is a fan around the center, the outline is a strip that goes around the shape
+            addCommand(sf::TrianglesFan, shape->getPointCount() + 2, shape->getTexture(), transform);
+            if (shape->getOutlineThickness() != 0)
+                addCommand(sf::TrianglesStrip, (shape->getPointCount() + 1) * 2, nullptr, transform);
+        }
+        else if (const sf::VertexArray* vertexArray = dynamic_cast<const sf::VertexArray*>(&drawable))
+        {
+            addCommand(vertexArray->getPrimitiveType(), vertexArray->getVertexCount(), states.texture, states.transform);
+        }
+        else // The amount of vertices of other objects is unknown
+            addCommand(sf::Points, 0, states.texture, states.transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingTarget::record(const sf::Vertex*, unsigned int vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        addCommand(type, vertexCount, states.texture, states.transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingTarget::setClipArea(const sf::IntRect& area)
+    {
+        if (area == m_ClipArea)
+            return;
+
+        m_ClipArea = area;
+        ++m_ClipChanges;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<RecordingTarget::DrawCommand>& RecordingTarget::getDrawCommands() const
+    {
+        return m_Commands;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int RecordingTarget::getDrawCallCount() const
+    {
+        return static_cast<unsigned int>(m_Commands.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int RecordingTarget::getVertexCount() const
+    {
+        return m_VertexCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int RecordingTarget::getTextureSwitchCount() const
+    {
+        return m_TextureSwitches;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int RecordingTarget::getClipChangeCount() const
+    {
+        return m_ClipChanges;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RecordingTarget::activate(bool)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingTarget::addCommand(sf::PrimitiveType type, unsigned int vertexCount, const sf::Texture* texture, const sf::Transform& transform)
+    {
+        // The first draw call only counts as a switch when it binds a texture
+        const sf::Texture* previousTexture = m_Commands.empty() ? nullptr : m_Commands.back().texture;
+        if (texture != previousTexture)
+            ++m_TextureSwitches;
+
+        DrawCommand command;
+        command.primitiveType = type;
+        command.vertexCount = vertexCount;
+        command.texture = texture;
+        command.transform = transform;
+        command.clipArea = m_ClipArea;
+        m_Commands.push_back(command);
+
+        m_VertexCount += vertexCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,387 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <cmath>
+
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/RecordingTarget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    RenderBatch* RenderBatch::m_ActiveBatch = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderBatch::RenderBatch() :
+        m_Target       (nullptr),
+        m_Recorder     (nullptr),
+        m_PreviousBatch(nullptr),
+        m_Enabled      (true),
+        m_DrawCalls    (0),
+        m_BatchCount   (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::begin(sf::RenderTarget& target)
+    {
+        m_Target = &target;
+        m_Recorder = dynamic_cast<RecordingTarget*>(&target);
+        m_DrawCalls = 0;
+
+        m_PreviousBatch = m_ActiveBatch;
+        m_ActiveBatch = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::end()
+    {
+        flush();
+
+        m_ActiveBatch = m_PreviousBatch;
+        m_PreviousBatch = nullptr;
+        m_Target = nullptr;
+        m_Recorder = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::flush()
+    {
+        for (unsigned int i = 0; i < m_BatchCount; ++i)
+        {
+            Batch& batch = m_Batches[i];
+
+            if (m_Recorder)
+                m_Recorder->record(&batch.vertices[0], static_cast<unsigned int>(batch.vertices.size()), sf::Quads, sf::RenderStates(batch.texture));
+            else
+                m_Target->draw(&batch.vertices[0], static_cast<unsigned int>(batch.vertices.size()), sf::Quads, sf::RenderStates(batch.texture));
+            ++m_DrawCalls;
+
+            batch.vertices.clear();
+        }
+
+        m_BatchCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::setEnabled(bool enabled)
+    {
+        if (m_Target)
+            flush();
+
+        m_Enabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RenderBatch::isEnabled() const
+    {
+        return m_Enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int RenderBatch::getDrawCallCount() const
+    {
+        return m_DrawCalls;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states)
+    {
+        RenderBatch* batch = getBatchFor(target, states);
+        if (batch == nullptr)
+        {
+            drawDirectly(target, sprite, states);
+            return;
+        }
+
+        // A sprite without texture isn't drawn
+        if (sprite.getTexture() == nullptr)
+            return;
+
+        const sf::IntRect& rect = sprite.getTextureRect();
+        const float width = static_cast<float>(std::abs(rect.width));
+        const float height = static_cast<float>(std::abs(rect.height));
+
+        const float left = static_cast<float>(rect.left);
+        const float right = left + rect.width;
+        const float top = static_cast<float>(rect.top);
+        const float bottom = top + rect.height;
+
+        const sf::Transform transform = states.transform * sprite.getTransform();
+        const sf::Color& color = sprite.getColor();
+
+        const sf::Vertex vertices[4] = {sf::Vertex(transform.transformPoint(0, 0), color, sf::Vector2f(left, top)),
+                                        sf::Vertex(transform.transformPoint(width, 0), color, sf::Vector2f(right, top)),
+                                        sf::Vertex(transform.transformPoint(width, height), color, sf::Vector2f(right, bottom)),
+                                        sf::Vertex(transform.transformPoint(0, height), color, sf::Vector2f(left, bottom))};
+
+        batch->addQuad(sprite.getTexture(), vertices);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::draw(sf::RenderTarget& target, const sf::RectangleShape& rectangle, const sf::RenderStates& states)
+    {
+        // Only plain rectangles are batched
+        if ((rectangle.getTexture() != nullptr) || (rectangle.getOutlineThickness() != 0))
+        {
+            draw(target, static_cast<const sf::Drawable&>(rectangle), states);
+            return;
+        }
+
+        RenderBatch* batch = getBatchFor(target, states);
+        if (batch == nullptr)
+        {
+            drawDirectly(target, rectangle, states);
+            return;
+        }
+
+        const sf::Transform transform = states.transform * rectangle.getTransform();
+        const sf::Color& color = rectangle.getFillColor();
+
+        sf::Vertex vertices[4];
+        for (unsigned int i = 0; i < 4; ++i)
+            vertices[i] = sf::Vertex(transform.transformPoint(rectangle.getPoint(i)), color);
+
+        batch->addQuad(nullptr, vertices);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::draw(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states)
+    {
+        // The lines of underlined text are not part of the font texture
+        if (text.getStyle() & sf::Text::Underlined)
+        {
+            draw(target, static_cast<const sf::Drawable&>(text), states);
+            return;
+        }
+
+        RenderBatch* batch = getBatchFor(target, states);
+        if (batch == nullptr)
+        {
+            drawDirectly(target, text, states);
+            return;
+        }
+
+        const sf::Font* font = text.getFont();
+        if (font == nullptr)
+            return;
+
+        // The characters are placed in the same way as sf::Text does it
+        const unsigned int characterSize = text.getCharacterSize();
+        const bool bold = (text.getStyle() & sf::Text::Bold) != 0;
+        const float italic = (text.getStyle() & sf::Text::Italic) ? 0.208f : 0.f;
+
+        const float hspace = static_cast<float>(font->getGlyph(L' ', characterSize, bold).advance);
+        const float vspace = static_cast<float>(font->getLineSpacing(characterSize));
+
+        const sf::Texture* texture = &font->getTexture(characterSize);
+        const sf::Transform transform = states.transform * text.getTransform();
+        const sf::Color& color = text.getColor();
+
+        const sf::String& string = text.getString();
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            sf::Uint32 curChar = string[i];
+
+            x += static_cast<float>(font->getKerning(prevChar, curChar, characterSize));
+            prevChar = curChar;
+
+            // Whitespace only moves the position of the next character
+            if (curChar == L' ')
+            {
+                x += hspace;
+                continue;
+            }
+            else if (curChar == L'\t')
+            {
+                x += hspace * 4;
+                continue;
+            }
+            else if (curChar == L'\n')
+            {
+                y += vspace;
+                x = 0;
+                continue;
+            }
+            else if (curChar == L'\v')
+            {
+                y += vspace * 4;
+                continue;
+            }
+
+            const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, bold);
+
+            const float left = static_cast<float>(glyph.bounds.left);
+            const float top = static_cast<float>(glyph.bounds.top);
+            const float right = left + glyph.bounds.width;
+            const float bottom = top + glyph.bounds.height;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left);
+            const float v1 = static_cast<float>(glyph.textureRect.top);
+            const float u2 = u1 + glyph.textureRect.width;
+            const float v2 = v1 + glyph.textureRect.height;
+
+            const sf::Vertex vertices[4] = {sf::Vertex(transform.transformPoint(x + left - italic * top, y + top), color, sf::Vector2f(u1, v1)),
+                                            sf::Vertex(transform.transformPoint(x + right - italic * top, y + top), color, sf::Vector2f(u2, v1)),
+                                            sf::Vertex(transform.transformPoint(x + right - italic * bottom, y + bottom), color, sf::Vector2f(u2, v2)),
+                                            sf::Vertex(transform.transformPoint(x + left - italic * bottom, y + bottom), color, sf::Vector2f(u1, v2))};
+
+            batch->addQuad(texture, vertices);
+
+            x += glyph.advance;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        // Everything that was collected has to be drawn first, to keep the drawing order
+        if (m_ActiveBatch && (m_ActiveBatch->m_Target == &target))
+        {
+            m_ActiveBatch->flush();
+            ++m_ActiveBatch->m_DrawCalls;
+        }
+
+        drawDirectly(target, drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::flushActive()
+    {
+        if (m_ActiveBatch)
+            m_ActiveBatch->flush();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderBatch* RenderBatch::getBatchFor(sf::RenderTarget& target, const sf::RenderStates& states)
+    {
+        // Objects drawn on another target (e.g. on a render cache) are not seen by the batch
+        if ((m_ActiveBatch == nullptr) || (m_ActiveBatch->m_Target != &target))
+            return nullptr;
+
+        // The batches are drawn with the default blend mode and without shader
+        if (m_ActiveBatch->m_Enabled && (states.shader == nullptr) && (states.blendMode == sf::BlendAlpha))
+            return m_ActiveBatch;
+
+        m_ActiveBatch->flush();
+        ++m_ActiveBatch->m_DrawCalls;
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::drawDirectly(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        RecordingTarget* recorder;
+        if (m_ActiveBatch && (m_ActiveBatch->m_Target == &target))
+            recorder = m_ActiveBatch->m_Recorder;
+        else
+            recorder = dynamic_cast<RecordingTarget*>(&target);
+
+        if (recorder)
+            recorder->record(drawable, states);
+        else
+            target.draw(drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::addQuad(const sf::Texture* texture, const sf::Vertex* vertices)
+    {
+        float minX = vertices[0].position.x;
+        float maxX = vertices[0].position.x;
+        float minY = vertices[0].position.y;
+        float maxY = vertices[0].position.y;
+        for (unsigned int i = 1; i < 4; ++i)
+        {
+            minX = TGUI_MINIMUM(minX, vertices[i].position.x);
+            maxX = TGUI_MAXIMUM(maxX, vertices[i].position.x);
+            minY = TGUI_MINIMUM(minY, vertices[i].position.y);
+            maxY = TGUI_MAXIMUM(maxY, vertices[i].position.y);
+        }
+
+        // Look for a batch with the same texture. The quad may only be moved back to it when it doesn't overlap anything
+        // that was submitted later, otherwise it would end up below something that should be drawn below it.
+        unsigned int index = m_BatchCount;
+        for (unsigned int i = m_BatchCount; (i > 0) && (m_BatchCount - i < MaxBatchesSearched); --i)
+        {
+            const Batch& batch = m_Batches[i - 1];
+            if (batch.texture == texture)
+            {
+                index = i - 1;
+                break;
+            }
+
+            if ((minX < batch.bounds.left + batch.bounds.width) && (maxX > batch.bounds.left)
+             && (minY < batch.bounds.top + batch.bounds.height) && (maxY > batch.bounds.top))
+                break;
+        }
+
+        if (index == m_BatchCount)
+        {
+            if (m_Batches.size() == m_BatchCount)
+                m_Batches.push_back(Batch());
+
+            m_Batches[index].texture = texture;
+            m_Batches[index].bounds = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+            ++m_BatchCount;
+        }
+        else
+        {
+            sf::FloatRect& bounds = m_Batches[index].bounds;
+            const float right = TGUI_MAXIMUM(bounds.left + bounds.width, maxX);
+            const float bottom = TGUI_MAXIMUM(bounds.top + bounds.height, maxY);
+
+            bounds.left = TGUI_MINIMUM(bounds.left, minX);
+            bounds.top = TGUI_MINIMUM(bounds.top, minY);
+            bounds.width = right - bounds.left;
+            bounds.height = bottom - bounds.top;
+        }
+
+        m_Batches[index].vertices.insert(m_Batches[index].vertices.end(), vertices, vertices + 4);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
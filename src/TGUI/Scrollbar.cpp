@@ -153,6 +153,8 @@ namespace tgui
 
     bool Scrollbar::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -180,10 +182,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("Scrollbar", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("Scrollbar");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -199,10 +200,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "separatehoverimage")
             {
@@ -407,6 +408,8 @@ namespace tgui
 
     void Scrollbar::setSize(float width, float height)
     {
+        appearanceChanged();
+
         // Don't do anything when the scrollbar wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -473,6 +476,8 @@ namespace tgui
             setValue(0);
         else if (m_Value > m_Maximum - m_LowValue)
             setValue(m_Maximum - m_LowValue);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,13 +496,15 @@ namespace tgui
                 m_Value = m_Maximum - m_LowValue;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_Value);
                 addCallback();
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -512,6 +519,8 @@ namespace tgui
             setValue(0);
         else if (m_Value > m_Maximum - m_LowValue)
             setValue(m_Maximum - m_LowValue);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -540,6 +549,8 @@ namespace tgui
                     setSize(m_Size.x, m_Size.y);
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,6 +586,7 @@ namespace tgui
     void Scrollbar::setArrowScrollAmount(unsigned int scrollAmount)
     {
         m_ScrollAmount = scrollAmount;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -589,6 +601,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_AutoHide = autoHide;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1075,7 +1088,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isOnlyBoundToParent(ValueChanged))
                 callbacks.push_back("ValueChanged");
 
             encodeList(callbacks, value);
@@ -1207,16 +1220,16 @@ namespace tgui
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover_M, states);
+                RenderBatch::draw(target, m_TextureTrackHover_M, states);
             else
-                target.draw(m_TextureTrackNormal_M, states);
+                RenderBatch::draw(target, m_TextureTrackNormal_M, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureTrackNormal_M, states);
+            RenderBatch::draw(target, m_TextureTrackNormal_M, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover_M, states);
+                RenderBatch::draw(target, m_TextureTrackHover_M, states);
         }
 
         // Reset the transformation (in case there was any rotation)
@@ -1235,16 +1248,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        RenderBatch::draw(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 }
 
                 // Calculate the real track height (height without the arrows)
@@ -1274,16 +1287,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        RenderBatch::draw(target, m_TextureThumbHover, states);
                     else
-                        target.draw(m_TextureThumbNormal, states);
+                        RenderBatch::draw(target, m_TextureThumbNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureThumbNormal, states);
+                    RenderBatch::draw(target, m_TextureThumbNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        RenderBatch::draw(target, m_TextureThumbHover, states);
                 }
 
                 // Set the transformation of the second arrow
@@ -1300,16 +1313,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        RenderBatch::draw(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 }
 
                 // Change the position of the second arrow
@@ -1331,16 +1344,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        RenderBatch::draw(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 }
 
                 // Calculate the real track width (width without the arrows)
@@ -1370,16 +1383,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        RenderBatch::draw(target, m_TextureThumbHover, states);
                     else
-                        target.draw(m_TextureThumbNormal, states);
+                        RenderBatch::draw(target, m_TextureThumbNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureThumbNormal, states);
+                    RenderBatch::draw(target, m_TextureThumbNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureThumbHover, states);
+                        RenderBatch::draw(target, m_TextureThumbHover, states);
                 }
 
                 // Set the transformation of the second arrow
@@ -1400,16 +1413,16 @@ namespace tgui
                 if (m_SeparateHoverImage)
                 {
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                     else
-                        target.draw(m_TextureArrowUpNormal, states);
+                        RenderBatch::draw(target, m_TextureArrowUpNormal, states);
                 }
                 else // The hover image should be drawn on top of the normal image
                 {
-                    target.draw(m_TextureArrowUpNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowUpNormal, states);
 
                     if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 }
 
                 // Set the translation of the second arrow
@@ -1421,16 +1434,16 @@ namespace tgui
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureArrowDownHover, states);
+                RenderBatch::draw(target, m_TextureArrowDownHover, states);
             else
-                target.draw(m_TextureArrowDownNormal, states);
+                RenderBatch::draw(target, m_TextureArrowDownNormal, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureArrowDownNormal, states);
+            RenderBatch::draw(target, m_TextureArrowDownNormal, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureArrowDownHover, states);
+                RenderBatch::draw(target, m_TextureArrowDownHover, states);
         }
     }
 
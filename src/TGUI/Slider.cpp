@@ -133,6 +133,8 @@ namespace tgui
 
     bool Slider::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -156,10 +158,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("Slider", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("Slider");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -175,10 +176,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "separatehoverimage")
             {
@@ -293,7 +294,7 @@ namespace tgui
                 // Set the thumb size
                 m_ThumbSize = sf::Vector2f(m_TextureThumbNormal.getSize());
 
-                m_TextureTrackNormal_M.data->texture.setRepeated(true);
+                m_TextureTrackNormal_M.setRepeated(true);
             }
             else
             {
@@ -307,7 +308,7 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Hover;
 
-                m_TextureTrackHover_M.data->texture.setRepeated(true);
+                m_TextureTrackHover_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -419,6 +420,8 @@ namespace tgui
 
     void Slider::setSize(float width, float height)
     {
+        appearanceChanged();
+
         // Don't do anything when the slider wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -445,8 +448,8 @@ namespace tgui
                     if (m_Size.y < minimumHeight)
                         m_Size.y = minimumHeight;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackHover_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackHover_M.getSize().x, static_cast<int>((m_Size.y - minimumHeight) / scaling)));
                 }
                 else
                 {
@@ -456,8 +459,8 @@ namespace tgui
                     if (m_Size.x < minimumWidth)
                         m_Size.x = minimumWidth;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, m_TextureTrackNormal_M.getSize().x, static_cast<int>((m_Size.x - minimumWidth) / scaling)));
                 }
             }
             else
@@ -470,8 +473,8 @@ namespace tgui
                     if (m_Size.y < minimumHeight)
                         m_Size.y = minimumHeight;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackNormal_M.getSize().y));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackHover_M.getSize().y));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackNormal_M.getSize().y));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.y - minimumHeight) / scaling), m_TextureTrackHover_M.getSize().y));
                 }
                 else
                 {
@@ -481,8 +484,8 @@ namespace tgui
                     if (m_Size.x < minimumWidth)
                         m_Size.x = minimumWidth;
 
-                    m_TextureTrackNormal_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackNormal_M.getSize().y));
-                    m_TextureTrackHover_M.sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackHover_M.getSize().y));
+                    m_TextureTrackNormal_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackNormal_M.getSize().y));
+                    m_TextureTrackHover_M.setTextureRect(sf::IntRect(0, 0, static_cast<int>((m_Size.x - minimumWidth) / scaling), m_TextureTrackHover_M.getSize().y));
                 }
             }
 
@@ -593,6 +596,8 @@ namespace tgui
         // When the value is below the minimum then adjust it
         if (m_Value < m_Minimum)
             setValue(m_Minimum);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -612,6 +617,8 @@ namespace tgui
         // When the value is above the maximum then adjust it
         if (m_Value > m_Maximum)
             setValue(m_Maximum);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -630,13 +637,15 @@ namespace tgui
                 m_Value = m_Maximum;
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_Value);
                 addCallback();
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -665,6 +674,8 @@ namespace tgui
                     setSize(m_Size.x, m_Size.y);
             }
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -931,7 +942,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isOnlyBoundToParent(ValueChanged))
                 callbacks.push_back("ValueChanged");
 
             encodeList(callbacks, value);
@@ -993,29 +1004,29 @@ namespace tgui
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureTrackHover_L, states);
-                    target.draw(m_TextureTrackHover_M, states);
-                    target.draw(m_TextureTrackHover_R, states);
+                    RenderBatch::draw(target, m_TextureTrackHover_L, states);
+                    RenderBatch::draw(target, m_TextureTrackHover_M, states);
+                    RenderBatch::draw(target, m_TextureTrackHover_R, states);
                 }
                 else
                 {
-                    target.draw(m_TextureTrackNormal_L, states);
-                    target.draw(m_TextureTrackNormal_M, states);
-                    target.draw(m_TextureTrackNormal_R, states);
+                    RenderBatch::draw(target, m_TextureTrackNormal_L, states);
+                    RenderBatch::draw(target, m_TextureTrackNormal_M, states);
+                    RenderBatch::draw(target, m_TextureTrackNormal_R, states);
                 }
             }
             else // The hover image is drawn on top of the normal one
             {
-                target.draw(m_TextureTrackNormal_L, states);
-                target.draw(m_TextureTrackNormal_M, states);
-                target.draw(m_TextureTrackNormal_R, states);
+                RenderBatch::draw(target, m_TextureTrackNormal_L, states);
+                RenderBatch::draw(target, m_TextureTrackNormal_M, states);
+                RenderBatch::draw(target, m_TextureTrackNormal_R, states);
 
                 // When the mouse is on top of the button then draw an extra image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
-                    target.draw(m_TextureTrackHover_L, states);
-                    target.draw(m_TextureTrackHover_M, states);
-                    target.draw(m_TextureTrackHover_R, states);
+                    RenderBatch::draw(target, m_TextureTrackHover_L, states);
+                    RenderBatch::draw(target, m_TextureTrackHover_M, states);
+                    RenderBatch::draw(target, m_TextureTrackHover_R, states);
                 }
             }
         }
@@ -1038,18 +1049,18 @@ namespace tgui
             if (m_SeparateHoverImage)
             {
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureTrackHover_M, states);
+                    RenderBatch::draw(target, m_TextureTrackHover_M, states);
                 else
-                    target.draw(m_TextureTrackNormal_M, states);
+                    RenderBatch::draw(target, m_TextureTrackNormal_M, states);
             }
             else
             {
                 // Draw the normal track image
-                target.draw(m_TextureTrackNormal_M, states);
+                RenderBatch::draw(target, m_TextureTrackNormal_M, states);
 
                 // When the mouse is on top of the slider then draw the hover image
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                    target.draw(m_TextureTrackHover_M, states);
+                    RenderBatch::draw(target, m_TextureTrackHover_M, states);
             }
         }
 
@@ -1086,11 +1097,11 @@ namespace tgui
         }
 
         // Draw the normal thumb image
-        target.draw(m_TextureThumbNormal, states);
+        RenderBatch::draw(target, m_TextureThumbNormal, states);
 
         // When the mouse is on top of the slider then draw the hover image
         if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-            target.draw(m_TextureThumbHover, states);
+            RenderBatch::draw(target, m_TextureThumbHover, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
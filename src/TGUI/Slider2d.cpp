@@ -23,8 +23,6 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Container.hpp>
 #include <TGUI/Slider2d.hpp>
 
@@ -131,10 +129,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("Slider2d", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("Slider2d");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -150,10 +147,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "separatehoverimage")
             {
@@ -200,6 +197,7 @@ namespace tgui
         {
             // Set the size of the slider
             m_Size = sf::Vector2f(m_TextureTrackNormal.getSize());
+            boundsChanged();
         }
         else
         {
@@ -238,6 +236,7 @@ namespace tgui
         // Store the size of the slider
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -258,6 +257,8 @@ namespace tgui
             m_Value.x = m_Minimum.x;
         if (m_Value.y < m_Minimum.y)
             m_Value.y = m_Minimum.y;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,6 +279,8 @@ namespace tgui
             m_Value.x = m_Maximum.x;
         if (m_Value.y > m_Maximum.y)
             m_Value.y = m_Maximum.y;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -297,6 +300,8 @@ namespace tgui
             m_Value.y = m_Minimum.y;
         else if (m_Value.y > m_Maximum.y)
             m_Value.y = m_Maximum.y;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,6 +330,7 @@ namespace tgui
     void Slider2d::setFixedThumbSize(bool fixedSize)
     {
         m_FixedThumbSize = fixedSize;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -339,6 +345,7 @@ namespace tgui
     void Slider2d::enableThumbCenter(bool autoCenterThumb)
     {
         m_ReturnThumbToCenter = autoCenterThumb;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,6 +353,7 @@ namespace tgui
     void Slider2d::centerThumb()
     {
         setValue(sf::Vector2f((m_Maximum.x + m_Minimum.x) * 0.5f, (m_Maximum.y + m_Minimum.y) * 0.5f));
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,7 +388,7 @@ namespace tgui
         {
             setValue(sf::Vector2f((m_Maximum.x + m_Minimum.x) * 0.5f, (m_Maximum.y + m_Minimum.y) * 0.5f));
 
-            if (m_CallbackFunctions[ThumbReturnedToCenter].empty() == false)
+            if (isCallbackBound(ThumbReturnedToCenter))
             {
                 m_Callback.trigger = ThumbReturnedToCenter;
                 m_Callback.value2d = m_Value;
@@ -428,7 +436,7 @@ namespace tgui
             setValue(m_Value);
 
             // Add the callback (if the user requested it)
-            if ((oldValue != m_Value) && (m_CallbackFunctions[ValueChanged].empty() == false))
+            if ((oldValue != m_Value) && (isCallbackBound(ValueChanged)))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value2d = m_Value;
@@ -457,7 +465,7 @@ namespace tgui
             {
                 setValue(sf::Vector2f((m_Maximum.x + m_Minimum.x) * 0.5f, (m_Maximum.y + m_Minimum.y) * 0.5f));
 
-                if (m_CallbackFunctions[ThumbReturnedToCenter].empty() == false)
+                if (isCallbackBound(ThumbReturnedToCenter))
                 {
                     m_Callback.trigger = ThumbReturnedToCenter;
                     m_Callback.value2d = m_Value;
@@ -605,9 +613,9 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isOnlyBoundToParent(ValueChanged))
                 callbacks.push_back("ValueChanged");
-            if ((m_CallbackFunctions.find(ThumbReturnedToCenter) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ThumbReturnedToCenter).size() == 1) && (m_CallbackFunctions.at(ThumbReturnedToCenter).front() == nullptr))
+            if (isOnlyBoundToParent(ThumbReturnedToCenter))
                 callbacks.push_back("ThumbReturnedToCenter");
 
             encodeList(callbacks, value);
@@ -646,18 +654,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -673,16 +669,16 @@ namespace tgui
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover, states);
+                RenderBatch::draw(target, m_TextureTrackHover, states);
             else
-                target.draw(m_TextureTrackNormal, states);
+                RenderBatch::draw(target, m_TextureTrackNormal, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureTrackNormal, states);
+            RenderBatch::draw(target, m_TextureTrackNormal, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureTrackHover, states);
+                RenderBatch::draw(target, m_TextureTrackHover, states);
         }
 
         // Undo the scale
@@ -703,43 +699,32 @@ namespace tgui
             states.transform.scale(scaling);
         }
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        // Drawn without gui, the slider needs its own clip stack
+        ClipStack clipStack;
+        clipStack.beginIfInactive(target);
 
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // The thumb may not be drawn outside the track
+        ClipStack::push(target, sf::FloatRect(getAbsolutePosition(), m_Size));
 
         // Draw the thumb image
         if (m_SeparateHoverImage)
         {
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureThumbHover, states);
+                RenderBatch::draw(target, m_TextureThumbHover, states);
             else
-                target.draw(m_TextureThumbNormal, states);
+                RenderBatch::draw(target, m_TextureThumbNormal, states);
         }
         else // The hover image should be drawn on top of the normal image
         {
-            target.draw(m_TextureThumbNormal, states);
+            RenderBatch::draw(target, m_TextureThumbNormal, states);
 
             if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
-                target.draw(m_TextureThumbHover, states);
+                RenderBatch::draw(target, m_TextureThumbHover, states);
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        ClipStack::pop(target);
+        clipStack.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
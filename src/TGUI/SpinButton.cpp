@@ -130,10 +130,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("SpinButton", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("SpinButton");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -149,10 +148,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "separatehoverimage")
             {
@@ -199,6 +198,7 @@ namespace tgui
         {
             m_Size.x = static_cast<float>(m_TextureArrowUpNormal.getSize().x);
             m_Size.y = static_cast<float>(m_TextureArrowUpNormal.getSize().y + m_TextureArrowDownNormal.getSize().y);
+            boundsChanged();
         }
         else
         {
@@ -233,6 +233,7 @@ namespace tgui
         // Store the new size
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         // A negative size is not allowed for this widget
         if (m_Size.x < 0) m_Size.x = -m_Size.x;
@@ -253,6 +254,8 @@ namespace tgui
         // When the value is below the minimum then adjust it
         if (m_Value < m_Minimum)
             m_Value = m_Minimum;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,6 +271,8 @@ namespace tgui
         // When the value is above the maximum then adjust it
         if (m_Value > m_Maximum)
             m_Value = m_Maximum;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -282,6 +287,8 @@ namespace tgui
             m_Value = m_Minimum;
         else if (m_Value > m_Maximum)
             m_Value = m_Maximum;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,6 +317,7 @@ namespace tgui
     void SpinButton::setVerticalScroll(bool verticalScroll)
     {
         m_VerticalScroll = verticalScroll;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -396,7 +404,7 @@ namespace tgui
             }
 
             // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[ValueChanged].empty() == false)
+            if (isCallbackBound(ValueChanged))
             {
                 m_Callback.trigger = ValueChanged;
                 m_Callback.value   = static_cast<int>(m_Value);
@@ -409,6 +417,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(float x, float y)
     {
+        const bool wasOnTopArrow = m_MouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_VerticalScroll)
         {
@@ -425,6 +435,10 @@ namespace tgui
                 m_MouseHoverOnTopArrow = true;
         }
 
+        // The hover image moves to the other arrow
+        if (m_MouseHoverOnTopArrow != wasOnTopArrow)
+            appearanceChanged();
+
         if (m_MouseHover == false)
             mouseEnteredWidget();
 
@@ -513,7 +527,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(ValueChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(ValueChanged).size() == 1) && (m_CallbackFunctions.at(ValueChanged).front() == nullptr))
+            if (isOnlyBoundToParent(ValueChanged))
                 callbacks.push_back("ValueChanged");
 
             encodeList(callbacks, value);
@@ -565,19 +579,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowUpNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                RenderBatch::draw(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 }
             }
 
@@ -590,19 +604,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        RenderBatch::draw(target, m_TextureArrowDownHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowDownNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                RenderBatch::draw(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (!m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        RenderBatch::draw(target, m_TextureArrowDownHover, states);
                 }
             }
         }
@@ -622,19 +636,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowUpNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowUpNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowUpNormal, states);
+                RenderBatch::draw(target, m_TextureArrowUpNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (!m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowUpHover, states);
+                        RenderBatch::draw(target, m_TextureArrowUpHover, states);
                 }
             }
 
@@ -647,19 +661,19 @@ namespace tgui
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        RenderBatch::draw(target, m_TextureArrowDownHover, states);
                 }
                 else
-                    target.draw(m_TextureArrowDownNormal, states);
+                    RenderBatch::draw(target, m_TextureArrowDownNormal, states);
             }
             else // The hover image should be drawn on top of the normal image
             {
-                target.draw(m_TextureArrowDownNormal, states);
+                RenderBatch::draw(target, m_TextureArrowDownNormal, states);
 
                 if ((m_MouseHover) && (m_WidgetPhase & WidgetPhase_Hover))
                 {
                     if (m_MouseHoverOnTopArrow)
-                        target.draw(m_TextureArrowDownHover, states);
+                        RenderBatch::draw(target, m_TextureArrowDownHover, states);
                 }
             }
         }
@@ -85,9 +85,10 @@ namespace tgui
         // Store the new size
         m_Size.x = width;
         m_Size.y = height;
+        boundsChanged();
 
         // Make sure the sprite has the correct size
-        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.data->texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.data->texture.getSize().y);
+        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.getSize().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +105,8 @@ namespace tgui
 
     void SpriteSheet::setCells(unsigned int rows, unsigned int columns)
     {
+        appearanceChanged();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -121,13 +124,13 @@ namespace tgui
         m_Columns = columns;
 
         // Make the correct part of the image visible
-        m_Texture.sprite.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.data->texture.getSize().x / m_Columns,
-                                                    (m_VisibleCell.y-1) * m_Texture.data->texture.getSize().y / m_Rows,
-                                                    static_cast<int>(m_Texture.data->texture.getSize().x / m_Columns),
-                                                    static_cast<int>(m_Texture.data->texture.getSize().y / m_Rows)));
+        m_Texture.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.getSize().x / m_Columns,
+                                             (m_VisibleCell.y-1) * m_Texture.getSize().y / m_Rows,
+                                             static_cast<int>(m_Texture.getSize().x / m_Columns),
+                                             static_cast<int>(m_Texture.getSize().y / m_Rows)));
 
         // Make sure the sprite has the correct size
-        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.data->texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.data->texture.getSize().y);
+        m_Texture.sprite.setScale((m_Size.x * m_Columns) / m_Texture.getSize().x, (m_Size.y * m_Rows) / m_Texture.getSize().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -135,6 +138,7 @@ namespace tgui
     void SpriteSheet::setRows(unsigned int rows)
     {
         setCells(rows, m_Columns);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,6 +153,7 @@ namespace tgui
     void SpriteSheet::setColumns(unsigned int columns)
     {
         setCells(m_Rows, columns);
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -162,6 +167,8 @@ namespace tgui
 
     void SpriteSheet::setVisibleCell(unsigned int row, unsigned int column)
     {
+        appearanceChanged();
+
         // Make sure that the picture was already loaded
         if (m_Loaded == false)
             return;
@@ -183,10 +190,10 @@ namespace tgui
         m_VisibleCell.y = row;
 
         // Make the correct part of the image visible
-        m_Texture.sprite.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.data->texture.getSize().x / m_Columns,
-                                                    (m_VisibleCell.y-1) * m_Texture.data->texture.getSize().y / m_Rows,
-                                                    static_cast<int>(m_Texture.data->texture.getSize().x / m_Columns),
-                                                    static_cast<int>(m_Texture.data->texture.getSize().y / m_Rows)));
+        m_Texture.setTextureRect(sf::IntRect((m_VisibleCell.x-1) * m_Texture.getSize().x / m_Columns,
+                                             (m_VisibleCell.y-1) * m_Texture.getSize().y / m_Rows,
+                                             static_cast<int>(m_Texture.getSize().x / m_Columns),
+                                             static_cast<int>(m_Texture.getSize().y / m_Rows)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
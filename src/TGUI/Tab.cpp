@@ -25,8 +25,6 @@
 
 #include <cmath>
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Container.hpp>
 #include <TGUI/Tab.hpp>
 
@@ -133,6 +131,8 @@ namespace tgui
 
     bool Tab::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // When everything is loaded successfully, this will become true.
@@ -154,10 +154,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("Tab", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("Tab");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -173,10 +172,10 @@ namespace tgui
             configFileFolder = m_LoadedConfigFile.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "separateselectedimage")
             {
@@ -192,7 +191,7 @@ namespace tgui
             }
             else if (property == "distancetoside")
             {
-                setDistanceToSide(static_cast<unsigned int>(atoi(value.c_str())));
+                setDistanceToSide(static_cast<unsigned int>(atoi(value.string.c_str())));
             }
             else if (property == "normalimage")
             {
@@ -278,7 +277,7 @@ namespace tgui
             {
                 m_TabHeight = m_TextureNormal_M.getSize().y;
 
-                m_TextureNormal_M.data->texture.setRepeated(true);
+                m_TextureNormal_M.setRepeated(true);
             }
             else
             {
@@ -291,7 +290,7 @@ namespace tgui
             {
                 m_WidgetPhase |= WidgetPhase_Selected;
 
-                m_TextureSelected_M.data->texture.setRepeated(true);
+                m_TextureSelected_M.setRepeated(true);
             }
         }
         else // The image isn't split
@@ -332,6 +331,8 @@ namespace tgui
 
     void Tab::setSize(float, float)
     {
+        appearanceChanged();
+
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -360,6 +361,8 @@ namespace tgui
 
     unsigned int Tab::add(const sf::String& name, bool selectTab)
     {
+        appearanceChanged();
+
         // Add the tab
         m_TabNames.push_back(name);
 
@@ -379,6 +382,8 @@ namespace tgui
 
     void Tab::select(const sf::String& name)
     {
+        appearanceChanged();
+
         // Loop through all tabs
         for (unsigned int i=0; i<m_TabNames.size(); ++i)
         {
@@ -398,6 +403,8 @@ namespace tgui
 
     void Tab::select(unsigned int index)
     {
+        appearanceChanged();
+
         // If the index is too big then do nothing
         if (index > m_TabNames.size()-1)
         {
@@ -414,12 +421,15 @@ namespace tgui
     void Tab::deselect()
     {
         m_SelectedTab = -1;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Tab::remove(const sf::String& name)
     {
+        appearanceChanged();
+
         // Loop through all tabs
         for (unsigned int i=0; i<m_TabNames.size(); ++i)
         {
@@ -447,6 +457,8 @@ namespace tgui
 
     void Tab::remove(unsigned int index)
     {
+        appearanceChanged();
+
         // The index can't be too high
         if (index > m_TabNames.size()-1)
         {
@@ -472,6 +484,8 @@ namespace tgui
         m_TabNames.clear();
         m_NameWidth.clear();
         m_SelectedTab = -1;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -503,6 +517,8 @@ namespace tgui
             m_Text.setString(m_TabNames[i]);
             m_NameWidth[i] = m_Text.getLocalBounds().width;
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -517,6 +533,7 @@ namespace tgui
     void Tab::setTextColor(const sf::Color& color)
     {
         m_TextColor = color;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -531,6 +548,7 @@ namespace tgui
     void Tab::setSelectedTextColor(const sf::Color& color)
     {
         m_SelectedTextColor = color;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -566,6 +584,8 @@ namespace tgui
             m_Text.setString(m_TabNames[i]);
             m_NameWidth[i] = m_Text.getLocalBounds().width;
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -588,6 +608,8 @@ namespace tgui
             if (m_TextSize == 0)
                 setTextSize(0);
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -602,6 +624,7 @@ namespace tgui
     void Tab::setMaximumTabWidth(unsigned int maximumWidth)
     {
         m_MaximumTabWidth = maximumWidth;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -616,6 +639,7 @@ namespace tgui
     void Tab::setDistanceToSide(unsigned int distanceToSide)
     {
         m_DistanceToSide = distanceToSide;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -680,7 +704,7 @@ namespace tgui
                 m_SelectedTab = i;
 
                 // Add the callback (if the user requested it)
-                if (m_CallbackFunctions[TabChanged].empty() == false)
+                if (isCallbackBound(TabChanged))
                 {
                     m_Callback.trigger = TabChanged;
                     m_Callback.value   = m_SelectedTab;
@@ -789,7 +813,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TabChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TabChanged).size() == 1) && (m_CallbackFunctions.at(TabChanged).front() == nullptr))
+            if (isOnlyBoundToParent(TabChanged))
                 callbacks.push_back("TabChanged");
 
             encodeList(callbacks, value);
@@ -838,15 +862,6 @@ namespace tgui
         if (m_Loaded == false)
             return;
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the scale factor of the view
-        const sf::View& view = target.getView();
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
         // Apply the transformations
         states.transform *= getTransform();
 
@@ -858,6 +873,9 @@ namespace tgui
         sf::FloatRect defaultRect;
         sf::Text tempText(m_Text);
 
+        // Only used to clip the names of the tabs when the tabs are drawn without gui
+        ClipStack clipStack;
+
         // Calculate the height and top of all strings
         tempText.setString("kg");
         defaultRect = tempText.getLocalBounds();
@@ -898,16 +916,16 @@ namespace tgui
                 if (m_SeparateSelectedImage)
                 {
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_L, states);
+                        RenderBatch::draw(target, m_TextureSelected_L, states);
                     else
-                        target.draw(m_TextureNormal_L, states);
+                        RenderBatch::draw(target, m_TextureNormal_L, states);
                 }
                 else // There is no separate selected image
                 {
-                    target.draw(m_TextureNormal_L, states);
+                    RenderBatch::draw(target, m_TextureNormal_L, states);
 
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_L, states);
+                        RenderBatch::draw(target, m_TextureSelected_L, states);
                 }
 
                 // Check if the middle image may be drawn
@@ -926,16 +944,16 @@ namespace tgui
                     if (m_SeparateSelectedImage)
                     {
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_M, states);
+                            RenderBatch::draw(target, m_TextureSelected_M, states);
                         else
-                            target.draw(m_TextureNormal_M, states);
+                            RenderBatch::draw(target, m_TextureNormal_M, states);
                     }
                     else // There is no separate selected image
                     {
-                        target.draw(m_TextureNormal_M, states);
+                        RenderBatch::draw(target, m_TextureNormal_M, states);
 
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_M, states);
+                            RenderBatch::draw(target, m_TextureSelected_M, states);
                     }
 
                     // Put the right image on the correct position
@@ -948,16 +966,16 @@ namespace tgui
                     if (m_SeparateSelectedImage)
                     {
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
+                            RenderBatch::draw(target, m_TextureSelected_R, states);
                         else
-                            target.draw(m_TextureNormal_R, states);
+                            RenderBatch::draw(target, m_TextureNormal_R, states);
                     }
                     else // There is no separate selected image
                     {
-                        target.draw(m_TextureNormal_R, states);
+                        RenderBatch::draw(target, m_TextureNormal_R, states);
 
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
+                            RenderBatch::draw(target, m_TextureSelected_R, states);
                     }
 
                     // Undo the translation
@@ -972,16 +990,16 @@ namespace tgui
                     if (m_SeparateSelectedImage)
                     {
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
+                            RenderBatch::draw(target, m_TextureSelected_R, states);
                         else
-                            target.draw(m_TextureNormal_R, states);
+                            RenderBatch::draw(target, m_TextureNormal_R, states);
                     }
                     else // There is no separate selected image
                     {
-                        target.draw(m_TextureNormal_R, states);
+                        RenderBatch::draw(target, m_TextureNormal_R, states);
 
                         if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                            target.draw(m_TextureSelected_R, states);
+                            RenderBatch::draw(target, m_TextureSelected_R, states);
                     }
 
                     // Undo the translation
@@ -1000,16 +1018,16 @@ namespace tgui
                 if (m_SeparateSelectedImage)
                 {
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_M, states);
+                        RenderBatch::draw(target, m_TextureSelected_M, states);
                     else
-                        target.draw(m_TextureNormal_M, states);
+                        RenderBatch::draw(target, m_TextureNormal_M, states);
                 }
                 else // There is no separate selected image
                 {
-                    target.draw(m_TextureNormal_M, states);
+                    RenderBatch::draw(target, m_TextureNormal_M, states);
 
                     if ((m_SelectedTab == static_cast<int>(i)) && (m_WidgetPhase & WidgetPhase_Selected))
-                        target.draw(m_TextureSelected_M, states);
+                        RenderBatch::draw(target, m_TextureSelected_M, states);
                 }
 
                 // Undo the scaling
@@ -1041,30 +1059,15 @@ namespace tgui
                 // Check if clipping is required for this text
                 if (clippingRequired)
                 {
-                    // Get the global position
-                    sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x + accumulatedTabWidth + m_DistanceToSide + (view.getSize().x / 2.f) - view.getCenter().x) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                                ((getAbsolutePosition().y + (view.getSize().y / 2.f) - view.getCenter().y) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-                    sf::Vector2f bottomRightPosition = sf::Vector2f(((getAbsolutePosition().x + accumulatedTabWidth + tabWidth - m_DistanceToSide - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                                    ((getAbsolutePosition().y + ((m_TabHeight + defaultRect.height) / 2.f) - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-
-                    // Calculate the clipping area
-                    GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-                    GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                    GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-                    GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                    // If the widget outside the window then don't draw anything
-                    if (scissorRight < scissorLeft)
-                        scissorRight = scissorLeft;
-                    else if (scissorBottom < scissorTop)
-                        scissorTop = scissorBottom;
-
-                    // Set the clipping area
-                    glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                    clipStack.beginIfInactive(target);
+                    ClipStack::push(target, sf::FloatRect(getAbsolutePosition().x + accumulatedTabWidth + m_DistanceToSide,
+                                                          getAbsolutePosition().y,
+                                                          tabWidth - (2.f * m_DistanceToSide),
+                                                          (m_TabHeight + defaultRect.height) / 2.f));
                 }
 
                 // Draw the text
-                target.draw(tempText, states);
+                RenderBatch::draw(target, tempText, states);
 
                 // Undo the translation of the text
                 states.transform.translate(-std::floor(realRect.left + 0.5f), -std::floor(realRect.top + 0.5f));
@@ -1073,7 +1076,8 @@ namespace tgui
                 if (clippingRequired)
                 {
                     clippingRequired = false;
-                    glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                    ClipStack::pop(target);
+                    clipStack.end();
                 }
             }
 
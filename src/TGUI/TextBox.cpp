@@ -23,8 +23,6 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <SFML/OpenGL.hpp>
-
 #include <TGUI/Scrollbar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/TextBox.hpp>
@@ -73,6 +71,7 @@ namespace tgui
     TextBox::TextBox(const TextBox& copy) :
     Widget                       (copy),
     WidgetBorders                (copy),
+    onTextChanged                (copy.onTextChanged),
     m_LoadedConfigFile           (copy.m_LoadedConfigFile),
     m_Size                       (copy.m_Size),
     m_Text                       (copy.m_Text),
@@ -135,6 +134,7 @@ namespace tgui
             this->Widget::operator=(right);
             this->WidgetBorders::operator=(right);
 
+            std::swap(onTextChanged,                 temp.onTextChanged);
             std::swap(m_LoadedConfigFile,            temp.m_LoadedConfigFile);
             std::swap(m_Size,                        temp.m_Size);
             std::swap(m_Text,                        temp.m_Text);
@@ -181,6 +181,8 @@ namespace tgui
 
     bool TextBox::load(const std::string& configFileFilename)
     {
+        appearanceChanged();
+
         m_LoadedConfigFile = getResourcePath() + configFileFilename;
 
         // If there already was a scrollbar then delete it now
@@ -198,10 +200,9 @@ namespace tgui
             return false;
         }
 
-        // Read the properties and their values (as strings)
-        std::vector<std::string> properties;
-        std::vector<std::string> values;
-        if (!configFile.read("TextBox", properties, values))
+        // Read the properties and their values
+        const ConfigSection* section = configFile.read("TextBox");
+        if (section == nullptr)
         {
             TGUI_OUTPUT("TGUI error: Failed to parse " + m_LoadedConfigFile + ".");
             return false;
@@ -217,10 +218,10 @@ namespace tgui
             configFileFolder = configFileFilename.substr(0, slashPos+1);
 
         // Handle the read properties
-        for (unsigned int i = 0; i < properties.size(); ++i)
+        for (unsigned int i = 0; i < section->properties.size(); ++i)
         {
-            std::string property = properties[i];
-            std::string value = values[i];
+            const std::string& property = section->properties[i];
+            const ConfigValue& value = section->values[i];
 
             if (property == "backgroundcolor")
             {
@@ -249,12 +250,12 @@ namespace tgui
             else if (property == "borders")
             {
                 Borders borders;
-                if (extractBorders(value, borders))
+                if (configFile.readBorders(value, borders))
                     setBorders(borders.left, borders.top, borders.right, borders.bottom);
             }
             else if (property == "scrollbar")
             {
-                if ((value.length() < 3) || (value[0] != '"') || (value[value.length()-1] != '"'))
+                if ((value.string.length() < 3) || (value.string[0] != '"') || (value.string[value.string.length()-1] != '"'))
                 {
                     TGUI_OUTPUT("TGUI error: Failed to parse value for Scrollbar in section ChatBox in " + m_LoadedConfigFile + ".");
                     return false;
@@ -262,7 +263,7 @@ namespace tgui
 
                 // load the scrollbar and check if it failed
                 m_Scroll = new Scrollbar();
-                if (m_Scroll->load(configFileFolder + value.substr(1, value.length()-2)) == false)
+                if (m_Scroll->load(configFileFolder + value.string.substr(1, value.string.length()-2)) == false)
                 {
                     // The scrollbar couldn't be loaded so it must be deleted
                     delete m_Scroll;
@@ -296,6 +297,8 @@ namespace tgui
 
     void TextBox::setSize(float width, float height)
     {
+        appearanceChanged();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -378,6 +381,8 @@ namespace tgui
 
     void TextBox::setText(const sf::String& text)
     {
+        appearanceChanged();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -393,6 +398,8 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
+        appearanceChanged();
+
         // Don't do anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
@@ -422,6 +429,8 @@ namespace tgui
         m_TextAfterSelection2.setFont(font);
 
         setTextSize(m_TextSize);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -435,6 +444,8 @@ namespace tgui
 
     void TextBox::setTextSize(unsigned int size)
     {
+        appearanceChanged();
+
         // Store the new text size
         m_TextSize = size;
 
@@ -494,6 +505,8 @@ namespace tgui
             // Set the selection point behind the last character
             setSelectionPointPosition(m_Text.getSize());
         }
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -511,6 +524,8 @@ namespace tgui
         m_TopBorder    = topBorder;
         m_RightBorder  = rightBorder;
         m_BottomBorder = bottomBorder;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -532,6 +547,8 @@ namespace tgui
         m_BackgroundColor               = backgroundColor;
         m_SelectedTextBgrColor          = selectedBgrColor;
         m_BorderColor                   = borderColor;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -539,6 +556,7 @@ namespace tgui
     void TextBox::setBackgroundColor(const sf::Color& backgroundColor)
     {
         m_BackgroundColor = backgroundColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,6 +566,8 @@ namespace tgui
         m_TextBeforeSelection.setColor(textColor);
         m_TextAfterSelection1.setColor(textColor);
         m_TextAfterSelection2.setColor(textColor);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -556,6 +576,8 @@ namespace tgui
     {
         m_TextSelection1.setColor(selectedTextColor);
         m_TextSelection2.setColor(selectedTextColor);
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -563,6 +585,7 @@ namespace tgui
     void TextBox::setSelectedTextBackgroundColor(const sf::Color& selectedTextBackgroundColor)
     {
         m_SelectedTextBgrColor = selectedTextBackgroundColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -570,6 +593,7 @@ namespace tgui
     void TextBox::setBorderColor(const sf::Color& borderColor)
     {
         m_BorderColor = borderColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -577,6 +601,7 @@ namespace tgui
     void TextBox::setSelectionPointColor(const sf::Color& selectionPointColor)
     {
         m_SelectionPointColor = selectionPointColor;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -625,6 +650,8 @@ namespace tgui
 
     void TextBox::setSelectionPointPosition(unsigned int charactersBeforeSelectionPoint)
     {
+        appearanceChanged();
+
         // The selection point position has to stay inside the string
         if (charactersBeforeSelectionPoint > m_Text.getSize())
             charactersBeforeSelectionPoint = m_Text.getSize();
@@ -706,6 +733,8 @@ namespace tgui
 
     bool TextBox::setScrollbar(const std::string& scrollbarConfigFileFilename)
     {
+        appearanceChanged();
+
         // Do nothing when the string is empty
         if (scrollbarConfigFileFilename.empty() == true)
             return false;
@@ -745,6 +774,8 @@ namespace tgui
         m_Scroll = nullptr;
 
         m_TopLine = 1;
+
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -752,6 +783,7 @@ namespace tgui
     void TextBox::setSelectionPointWidth(unsigned int width)
     {
         m_SelectionPointWidth = width;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -766,6 +798,7 @@ namespace tgui
     void TextBox::setReadOnly(bool readOnly)
     {
         m_readOnly = readOnly;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1027,6 +1060,8 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if (m_Scroll != nullptr)
         {
+            const bool scrollHover = m_Scroll->m_MouseHover;
+
             // Temporarily set the position of the scroll
             m_Scroll->setPosition(getPosition().x + m_Size.x - m_Scroll->getSize().x, getPosition().y);
 
@@ -1056,6 +1091,10 @@ namespace tgui
 
             // Reset the position
             m_Scroll->setPosition(0, 0);
+
+            // The scrollbar is not a child widget, so it can't tell itself that its hover state changed
+            if (m_Scroll->m_MouseHover != scrollHover)
+                appearanceChanged();
         }
         else // There is no scrollbar
         {
@@ -1401,11 +1440,14 @@ namespace tgui
             m_SelectionPointVisible = true;
             m_AnimationTimeElapsed = sf::Time();
 
-            // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[TextChanged].empty() == false)
+            // Send the signal and add the callback (if the user requested it)
+            onTextChanged(m_Text);
+            if (isCallbackBound(TextChanged))
             {
                 m_Callback.trigger = TextChanged;
-                m_Callback.text    = m_Text;
+                if (isCallbackDataNeeded(TextChanged))
+                    m_Callback.text = m_Text;
+
                 addCallback();
             }
         }
@@ -1448,11 +1490,14 @@ namespace tgui
             m_SelectionPointVisible = true;
             m_AnimationTimeElapsed = sf::Time();
 
-            // Add the callback (if the user requested it)
-            if (m_CallbackFunctions[TextChanged].empty() == false)
+            // Send the signal and add the callback (if the user requested it)
+            onTextChanged(m_Text);
+            if (isCallbackBound(TextChanged))
             {
                 m_Callback.trigger = TextChanged;
-                m_Callback.text    = m_Text;
+                if (isCallbackDataNeeded(TextChanged))
+                    m_Callback.text = m_Text;
+
                 addCallback();
             }
         }
@@ -1489,11 +1534,14 @@ namespace tgui
 
                         setSelectionPointPosition(oldCaretPos + clipboardContents.getSize());
 
-                        // Add the callback (if the user requested it)
-                        if (m_CallbackFunctions[TextChanged].empty() == false)
+                        // Send the signal and add the callback (if the user requested it)
+                        onTextChanged(m_Text);
+                        if (isCallbackBound(TextChanged))
                         {
                             m_Callback.trigger = TextChanged;
-                            m_Callback.text    = m_Text;
+                            if (isCallbackDataNeeded(TextChanged))
+                                m_Callback.text = m_Text;
+
                             addCallback();
                         }
                     }
@@ -1612,11 +1660,14 @@ namespace tgui
         m_SelectionPointVisible = true;
         m_AnimationTimeElapsed = sf::Time();
 
-        // Add the callback (if the user requested it)
-        if (m_CallbackFunctions[TextChanged].empty() == false)
+        // Send the signal and add the callback (if the user requested it)
+        onTextChanged(m_Text);
+        if (isCallbackBound(TextChanged))
         {
             m_Callback.trigger = TextChanged;
-            m_Callback.text    = m_Text;
+            if (isCallbackDataNeeded(TextChanged))
+                m_Callback.text = m_Text;
+
             addCallback();
         }
     }
@@ -1780,7 +1831,7 @@ namespace tgui
 
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(TextChanged) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(TextChanged).size() == 1) && (m_CallbackFunctions.at(TextChanged).front() == nullptr))
+            if (isOnlyBoundToParent(TextChanged))
                 callbacks.push_back("TextChanged");
 
             encodeList(callbacks, value);
@@ -1988,6 +2039,8 @@ namespace tgui
 
     void TextBox::selectText(float posX, float posY)
     {
+        appearanceChanged();
+
         // Don't continue when line height is 0
         if (m_LineHeight == 0)
             return;
@@ -2382,30 +2435,38 @@ namespace tgui
         // Switch the value of the visible flag
         m_SelectionPointVisible = !m_SelectionPointVisible;
 
+        // The selection point is only drawn while the widget is focused
+        if (m_Focused)
+            appearanceChanged();
+
         // Too slow for double clicking
         m_PossibleDoubleClick = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextBox::getTimeUntilUpdate(sf::Time& time) const
+    {
+        // The selection point is only drawn while the widget is focused
+        if ((m_Focused == false) || (m_Visible == false))
+            return false;
+
+        if (m_AnimationTimeElapsed < sf::milliseconds(500))
+            time = sf::milliseconds(500) - m_AnimationTimeElapsed;
+        else
+            time = sf::Time::Zero;
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Don't draw anything when the text box wasn't loaded correctly
         if (m_Loaded == false)
             return;
 
-        const sf::View& view = target.getView();
-
-        // Calculate the scale factor of the view
-        float scaleViewX = target.getSize().x / view.getSize().x;
-        float scaleViewY = target.getSize().y / view.getSize().y;
-
-        // Get the global position
-        sf::Vector2f topLeftPosition = sf::Vector2f(((getAbsolutePosition().x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                    ((getAbsolutePosition().y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-        sf::Vector2f bottomRightPosition = sf::Vector2f((getAbsolutePosition().x + m_Size.x - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                        (getAbsolutePosition().y + m_Size.y - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
         // Adjust the transformation
         states.transform *= getTransform();
 
@@ -2418,28 +2479,28 @@ namespace tgui
             sf::RectangleShape border(sf::Vector2f(static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y + m_TopBorder)));
             border.setPosition(-static_cast<float>(m_LeftBorder), -static_cast<float>(m_TopBorder));
             border.setFillColor(m_BorderColor);
-            target.draw(border, states);
+            RenderBatch::draw(target, border, states);
 
             // Draw top border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_RightBorder), static_cast<float>(m_TopBorder)));
             border.setPosition(0, -static_cast<float>(m_TopBorder));
-            target.draw(border, states);
+            RenderBatch::draw(target, border, states);
 
             // Draw right border
             border.setSize(sf::Vector2f(static_cast<float>(m_RightBorder), static_cast<float>(m_Size.y + m_BottomBorder)));
             border.setPosition(static_cast<float>(m_Size.x), 0);
-            target.draw(border, states);
+            RenderBatch::draw(target, border, states);
 
             // Draw bottom border
             border.setSize(sf::Vector2f(static_cast<float>(m_Size.x + m_LeftBorder), static_cast<float>(m_BottomBorder)));
             border.setPosition(-static_cast<float>(m_LeftBorder), static_cast<float>(m_Size.y));
-            target.draw(border, states);
+            RenderBatch::draw(target, border, states);
         }
 
         // Draw the background
         sf::RectangleShape front(sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y)));
         front.setFillColor(m_BackgroundColor);
-        target.draw(front, states);
+        RenderBatch::draw(target, front, states);
 
         // Set the text on the correct position
         if (m_Scroll != nullptr)
@@ -2450,24 +2511,12 @@ namespace tgui
         // Remeber this tranformation
         sf::Transform oldTransform = states.transform;
 
-        // Get the old clipping area
-        GLint scissor[4];
-        glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-        // Calculate the clipping area
-        GLint scissorLeft = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-        GLint scissorTop = TGUI_MAXIMUM(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-        GLint scissorRight = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-        GLint scissorBottom = TGUI_MINIMUM(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-        // If the widget outside the window then don't draw anything
-        if (scissorRight < scissorLeft)
-            scissorRight = scissorLeft;
-        else if (scissorBottom < scissorTop)
-            scissorTop = scissorBottom;
+        // The lines are also clipped when the text box is drawn without gui
+        ClipStack clipStack;
+        clipStack.beginIfInactive(target);
 
-        // Set the clipping area
-        glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+        // Don't draw the text outside the text box
+        ClipStack::push(target, sf::FloatRect(getAbsolutePosition(), sf::Vector2f(static_cast<float>(m_Size.x), static_cast<float>(m_Size.y))));
 
         sf::Text tempText(m_TextBeforeSelection);
         tempText.setString("kg");
@@ -2475,7 +2524,7 @@ namespace tgui
 
         // Draw the text
         states.transform.translate(-textShift.x, -textShift.y);
-        target.draw(m_TextBeforeSelection, states);
+        RenderBatch::draw(target, m_TextBeforeSelection, states);
         states.transform.translate(0, textShift.y);
 
         // Check if there is a selection
@@ -2498,11 +2547,11 @@ namespace tgui
             selectionBackground1.setFillColor(m_SelectedTextBgrColor);
 
             // Draw the selection background
-            target.draw(selectionBackground1, states);
+            RenderBatch::draw(target, selectionBackground1, states);
 
             // Draw the first part of the selected text
             states.transform.translate(0, -textShift.y);
-            target.draw(m_TextSelection1, states);
+            RenderBatch::draw(target, m_TextSelection1, states);
             states.transform.translate(0, textShift.y);
 
             // Check if there is a second part in the selection
@@ -2523,13 +2572,13 @@ namespace tgui
                 for (unsigned int i=0; i<m_MultilineSelectionRectWidth.size(); ++i)
                 {
                     selectionBackground2.setSize(sf::Vector2f(m_MultilineSelectionRectWidth[i], static_cast<float>(m_LineHeight)));
-                    target.draw(selectionBackground2, states);
+                    RenderBatch::draw(target, selectionBackground2, states);
                     selectionBackground2.move(0, static_cast<float>(m_LineHeight));
                 }
 
                 // Draw the second part of the selection
                 states.transform.translate(0, -textShift.y);
-                target.draw(m_TextSelection2, states);
+                RenderBatch::draw(target, m_TextSelection2, states);
                 states.transform.translate(0, textShift.y);
 
                 // Translate to the end of the selection
@@ -2551,7 +2600,7 @@ namespace tgui
 
             // Draw the first part of the text behind the selection
             states.transform.translate(0, -textShift.y);
-            target.draw(m_TextAfterSelection1, states);
+            RenderBatch::draw(target, m_TextAfterSelection1, states);
             states.transform.translate(textShift.x, textShift.y);
 
             // Check if there is a second part in the selection
@@ -2583,7 +2632,7 @@ namespace tgui
 
                 // Draw the second part of the text after the selection
                 states.transform.translate(-textShift.x, -textShift.y);
-                target.draw(m_TextAfterSelection2, states);
+                RenderBatch::draw(target, m_TextAfterSelection2, states);
                 states.transform.translate(textShift.x, textShift.y);
             }
         }
@@ -2604,12 +2653,13 @@ namespace tgui
                 selectionPoint.setFillColor(m_SelectionPointColor);
 
                 // Draw the selection point
-                target.draw(selectionPoint, states);
+                RenderBatch::draw(target, selectionPoint, states);
             }
         }
 
         // Reset the old clipping area
-        glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        ClipStack::pop(target);
+        clipStack.end();
 
         // Check if there is a scrollbar
         if (m_Scroll != nullptr)
@@ -25,10 +25,17 @@
 
 #include <TGUI/Global.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    const unsigned int TextureManager::AtlasPadding;
+    const unsigned int TextureManager::MaxAtlasPageSize;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Texture::Texture() :
@@ -41,7 +48,7 @@ namespace tgui
     sf::Vector2u Texture::getSize() const
     {
         if (data != nullptr)
-            return data->texture.getSize();
+            return sf::Vector2u(data->rect.width, data->rect.height);
         else
             return sf::Vector2u(0, 0);
     }
@@ -50,14 +57,119 @@ namespace tgui
 
     bool Texture::isTransparentPixel(unsigned int x, unsigned int y)
     {
-        if (data->image->getPixel(x + data->rect.left, y + data->rect.top).a == 0)
-            return true;
-        else
-            return false;
+        // The pixels are no longer in memory, but a mask was made to know which pixels are transparent
+        const ImageMapData& imageData = *data->imageData;
+        return !imageData.alphaMask[((y + data->rect.top) * imageData.size.x) + x + data->rect.left];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Texture::setTextureRect(const sf::IntRect& rect)
+    {
+        sf::Lock lock(TGUI_TextureManager.m_Mutex);
+
+        // Widgets also set the rect of optional textures that weren't loaded
+        if (data != nullptr)
+            sprite.setTextureRect(sf::IntRect(rect.left + data->offset.x, rect.top + data->offset.y, rect.width, rect.height));
+        else
+            sprite.setTextureRect(rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::setRepeated(bool repeated)
+    {
+        sf::Lock lock(TGUI_TextureManager.m_Mutex);
+
+        // A part of a bigger texture can't be repeated, so it has to use the texture that was made for the repeated part
+        if ((data->imageData != nullptr) && (data->texture != &data->ownTexture)
+         && (data->repeated || (data->texture->getSize() != getSize())))
+        {
+            if (repeated != data->repeated)
+                TGUI_TextureManager.switchTextureData(*this, repeated);
+        }
+        else
+            data->texture->setRepeated(repeated);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Texture::isRepeated() const
+    {
+        sf::Lock lock(TGUI_TextureManager.m_Mutex);
+
+        return data->texture->isRepeated();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::setSmooth(bool smooth)
+    {
+        sf::Lock lock(TGUI_TextureManager.m_Mutex);
+
+        // Smoothing an atlas page would affect the other images on it and would blend their pixels into this one
+        if ((data->imageData != nullptr) && (data->texture != &data->ownTexture) && (data->imageData->atlasPage != nullptr)
+         && !data->repeated && (smooth != data->texture->isSmooth()))
+        {
+            moveToOwnTexture();
+        }
+
+        data->texture->setSmooth(smooth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Texture::isSmooth() const
+    {
+        sf::Lock lock(TGUI_TextureManager.m_Mutex);
+
+        return data->texture->isSmooth();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::moveToOwnTexture()
+    {
+        sf::Lock lock(TGUI_TextureManager.m_Mutex);
+
+        // The other textures that show the same part have to keep using the shared texture, so this one gets its own data
+        if (data->users > 1)
+        {
+            ImageMapData& imageData = *data->imageData;
+            imageData.data.push_back(TextureData());
+
+            TextureData& ownData = imageData.data.back();
+            ownData.imageData = data->imageData;
+            ownData.texture = data->texture;
+            ownData.rect = data->rect;
+            ownData.offset = data->offset;
+            ownData.filename = data->filename;
+            ownData.users = 1;
+            ownData.imageIt = data->imageIt;
+            ownData.dataIt = --imageData.data.end();
+
+            --(data->users);
+            data = &ownData;
+        }
+
+        sf::IntRect currentRect = sprite.getTextureRect();
+
+        // When the pixels were freed after uploading them, they have to be read back from the graphics card
+        if (data->imageData->image)
+            data->ownTexture.loadFromImage(*data->imageData->image, data->rect);
+        else
+            data->ownTexture.loadFromImage(data->texture->copyToImage(), sf::IntRect(data->offset.x, data->offset.y, data->rect.width, data->rect.height));
+        data->ownTexture.setSmooth(data->texture->isSmooth());
+        data->ownTexture.setRepeated(data->texture->isRepeated());
+        data->texture = &data->ownTexture;
+
+        sprite.setTexture(*data->texture);
+        sprite.setTextureRect(sf::IntRect(currentRect.left - data->offset.x, currentRect.top - data->offset.y, currentRect.width, currentRect.height));
+        data->offset = sf::Vector2i(0, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Texture::operator const sf::Sprite&() const
     {
         return sprite;
@@ -66,134 +178,941 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    PreloadJob::PreloadJob(const std::vector<std::string>& filenamesToLoad) :
+    filenames     (filenamesToLoad),
+    images        (filenamesToLoad.size()),
+    decoded       (filenamesToLoad.size(), false),
+    nextImage     (0),
+    decodedImages (0),
+    uploaded      (false),
+    success       (false)
+    {
+        // Use one thread per core, but never more threads than there are images
+        unsigned int threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        threadCount = std::min(threadCount, static_cast<unsigned int>(filenames.size()));
+
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            threads.push_back(new sf::Thread(&PreloadJob::decode, this));
+            threads.back()->launch();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PreloadJob::~PreloadJob()
+    {
+        // Deleting the threads waits until they are finished
+        for (std::vector<sf::Thread*>::iterator it = threads.begin(); it != threads.end(); ++it)
+            delete *it;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PreloadJob::decode()
+    {
+        while (true)
+        {
+            // Take the next image that nobody is decoding yet
+            std::vector<std::string>::size_type index;
+            {
+                sf::Lock lock(mutex);
+                if (nextImage == filenames.size())
+                    return;
+
+                index = nextImage++;
+            }
+
+            images[index].reset(new sf::Image());
+            decoded[index] = images[index]->loadFromFile(filenames[index]);
+
+            sf::Lock lock(mutex);
+            ++decodedImages;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PreloadHandle::isDecoded() const
+    {
+        if (!m_Job)
+            return false;
+
+        sf::Lock lock(m_Job->mutex);
+        return m_Job->decodedImages == m_Job->filenames.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PreloadHandle::isFinished() const
+    {
+        if (!m_Job)
+            return false;
+
+        return m_Job->uploaded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float PreloadHandle::getProgress() const
+    {
+        if (!m_Job)
+            return 0;
+
+        sf::Lock lock(m_Job->mutex);
+        if (m_Job->filenames.empty())
+            return 1;
+        else
+            return static_cast<float>(m_Job->decodedImages) / m_Job->filenames.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::TextureManager() :
+    m_KeepImagesInMemory(false)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TextureManager::getTexture(const std::string& filename, Texture& texture, const sf::IntRect& rect)
     {
+        sf::Lock lock(m_Mutex);
+
+        // When the image is still being decoded in the background then wait for it instead of decoding it again
+        finishPreloadOfImage(filename);
+
         // Look if we already had this image
         auto imageIt = m_ImageMap.find(filename);
+        if (imageIt == m_ImageMap.end())
+        {
+            imageIt = m_ImageMap.insert(std::make_pair(filename, ImageMapData())).first;
+
+            // Decode the image and upload it to the graphics card, this only happens once per file
+            imageIt->second.image.reset(new sf::Image());
+            if (!imageIt->second.image->loadFromFile(filename) || !imageIt->second.texture.loadFromImage(*imageIt->second.image))
+            {
+                m_ImageMap.erase(imageIt);
+                texture.data = nullptr;
+                return false;
+            }
+
+            imageUploaded(imageIt);
+        }
+
+        const sf::IntRect part = getPart(imageIt->second.size, rect);
+        TextureData* data = getTextureData(imageIt, part, false);
+
+        // Let the sprite show the requested part of the texture
+        texture.data = data;
+        texture.sprite.setTexture(*data->texture);
+        texture.setTextureRect(sf::IntRect(0, 0, part.width, part.height));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getTexture(CachedImage& cache, const std::string& rootPath, const std::string& filename, Texture& texture, const sf::IntRect& rect)
+    {
+        sf::Lock lock(m_Mutex);
+
+        // Look up the image by its filename when it wasn't cached yet or when it was removed in the meantime
+        std::shared_ptr<ImageHandle> handle = cache.image.lock();
+        if (!handle || (cache.rootPath != rootPath))
+        {
+            if (!getTexture(rootPath + filename, texture, rect))
+                return false;
+
+            ImageMapData& imageData = texture.data->imageIt->second;
+            if (!imageData.handle)
+            {
+                imageData.handle = std::make_shared<ImageHandle>();
+                imageData.handle->imageIt = texture.data->imageIt;
+            }
+
+            cache.image = imageData.handle;
+            cache.rootPath = rootPath;
+            cache.part = texture.data->rect;
+            return true;
+        }
+
+        TextureData* data = getTextureData(handle->imageIt, cache.part, false);
+
+        // Let the sprite show the requested part of the texture
+        texture.data = data;
+        texture.sprite.setTexture(*data->texture);
+        texture.setTextureRect(sf::IntRect(0, 0, cache.part.width, cache.part.height));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::copyTexture(const Texture& textureToCopy, Texture& newTexture)
+    {
+        sf::Lock lock(m_Mutex);
+
+        // Ignore null pointers
+        if (textureToCopy.data == nullptr)
+        {
+            newTexture.data = nullptr;
+            return true;
+        }
+
+        // Only textures that were loaded by the texture manager can be shared
+        if (textureToCopy.data->imageData == nullptr)
+        {
+            TGUI_OUTPUT("TGUI warning: Can't copy texture that wasn't loaded by TextureManager.");
+            return false;
+        }
+
+        // The texture is now used at multiple places
+        ++(textureToCopy.data->users);
+        newTexture = textureToCopy;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(Texture& textureToRemove)
+    {
+        sf::Lock lock(m_Mutex);
+
+        TextureData* data = textureToRemove.data;
+
+        // Only textures that were loaded by the texture manager can be removed
+        if ((data == nullptr) || (data->imageData == nullptr))
+        {
+            TGUI_OUTPUT("TGUI warning: Can't remove texture that wasn't loaded by TextureManager.");
+            return;
+        }
+
+        // If this was the only place where the texture is used then delete it
+        if (--(data->users) == 0)
+        {
+            // Remove the texture from the list, or even the whole image if it isn't used anywhere else
+            ImageMap::iterator imageIt = data->imageIt;
+            if (imageIt->second.data.size() == 1)
+                removeImage(imageIt);
+            else
+                imageIt->second.data.erase(data->dataIt);
+        }
+
+        // The pointer is now useless
+        textureToRemove.data = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::buildAtlas(const std::vector<std::string>& filenames)
+    {
+        sf::Lock lock(m_Mutex);
+
+        bool success = true;
+
+        // Decode the images that weren't loaded yet
+        std::vector<ImageMap::iterator> images;
+        for (std::vector<std::string>::const_iterator filenameIt = filenames.begin(); filenameIt != filenames.end(); ++filenameIt)
+        {
+            // Images that are still being decoded in the background don't have to be decoded again
+            finishPreloadOfImage(*filenameIt);
+
+            if (m_ImageMap.find(*filenameIt) != m_ImageMap.end())
+                continue;
+
+            ImageMap::iterator imageIt = m_ImageMap.insert(std::make_pair(*filenameIt, ImageMapData())).first;
+            imageIt->second.image.reset(new sf::Image());
+            if (imageIt->second.image->loadFromFile(*filenameIt))
+                images.push_back(imageIt);
+            else
+            {
+                m_ImageMap.erase(imageIt);
+                success = false;
+            }
+        }
+
+        return uploadImages(images) && success;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::addRepeatedPart(const std::string& filename, const sf::IntRect& rect)
+    {
+        sf::Lock lock(m_Mutex);
+
+        std::vector<sf::IntRect>& rects = m_RepeatedParts[filename];
+        if (std::find(rects.begin(), rects.end(), rect) != rects.end())
+            return;
+
+        rects.push_back(rect);
+
+        // When the image was already loaded then the texture for the part is created right away
+        ImageMap::iterator imageIt = m_ImageMap.find(filename);
         if (imageIt != m_ImageMap.end())
+            getRepeatedPart(imageIt, getPart(imageIt->second.size, rect));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PreloadHandle TextureManager::preload(const std::vector<std::string>& filenames)
+    {
+        sf::Lock lock(m_Mutex);
+
+        // Only the images that aren't loaded or being loaded yet have to be decoded
+        std::vector<std::string> newFilenames;
+        for (std::vector<std::string>::const_iterator filenameIt = filenames.begin(); filenameIt != filenames.end(); ++filenameIt)
         {
-            // Loop all our textures to find the one containing the image
-            for (std::list<TextureData>::iterator it = imageIt->second.data.begin(); it != imageIt->second.data.end(); ++it)
+            if ((m_ImageMap.find(*filenameIt) == m_ImageMap.end())
+             && (std::find(newFilenames.begin(), newFilenames.end(), *filenameIt) == newFilenames.end()))
             {
-                // Only reuse the texture when the exact same part of the image is used
-                if (it->rect == rect)
+                bool alreadyPreloading = false;
+                for (std::list<std::shared_ptr<PreloadJob>>::const_iterator it = m_Preloads.begin(); it != m_Preloads.end(); ++it)
                 {
-                    // The texture is now used at multiple places
-                    ++(it->users);
+                    if (std::find((*it)->filenames.begin(), (*it)->filenames.end(), *filenameIt) != (*it)->filenames.end())
+                    {
+                        alreadyPreloading = true;
+                        break;
+                    }
+                }
+
+                if (!alreadyPreloading)
+                    newFilenames.push_back(*filenameIt);
+            }
+        }
+
+        PreloadHandle handle;
+        handle.m_Job = std::make_shared<PreloadJob>(newFilenames);
+        m_Preloads.push_back(handle.m_Job);
+        return handle;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::finishPreload(const PreloadHandle& handle)
+    {
+        sf::Lock lock(m_Mutex);
 
-                    // We already have the texture, so pass the data
-                    texture.data = &(*it);
+        std::shared_ptr<PreloadJob> job = handle.m_Job;
+        if (!job)
+            return false;
+
+        // Nothing has to be done when the images were already uploaded
+        if (job->uploaded)
+            return job->success;
+
+        // Wait until all images are decoded
+        for (std::vector<sf::Thread*>::iterator it = job->threads.begin(); it != job->threads.end(); ++it)
+            (*it)->wait();
+
+        m_Preloads.remove(job);
+
+        // Move the decoded images to the image map
+        job->success = true;
+        std::vector<ImageMap::iterator> images;
+        for (std::vector<std::string>::size_type i = 0; i < job->filenames.size(); ++i)
+        {
+            if (!job->decoded[i])
+            {
+                job->success = false;
+                continue;
+            }
 
-                    // Set the texture in the sprite
-                    texture.sprite.setTexture(it->texture, true);
+            if (m_ImageMap.find(job->filenames[i]) == m_ImageMap.end())
+            {
+                ImageMap::iterator imageIt = m_ImageMap.insert(std::make_pair(job->filenames[i], ImageMapData())).first;
+                imageIt->second.image = std::move(job->images[i]);
+                images.push_back(imageIt);
+            }
 
-                    return true;
+            job->images[i].reset();
+        }
+
+        // Only the upload has to happen on this thread
+        if (!uploadImages(images))
+            job->success = false;
+
+        job->uploaded = true;
+        return job->success;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeUnusedImages()
+    {
+        sf::Lock lock(m_Mutex);
+
+        // An image without texture data was packed or preloaded, but was never requested or is no longer used
+        for (ImageMap::iterator imageIt = m_ImageMap.begin(); imageIt != m_ImageMap.end(); )
+        {
+            if (imageIt->second.data.empty())
+                removeImage(imageIt++);
+            else
+                ++imageIt;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::uploadImages(std::vector<ImageMap::iterator> images)
+    {
+        bool success = true;
+
+        const unsigned int maxPageSize = std::min(sf::Texture::getMaximumSize(), MaxAtlasPageSize);
+
+        // Images that are too big to fit on a page get a texture of their own
+        for (std::vector<ImageMap::iterator>::iterator it = images.begin(); it != images.end(); )
+        {
+            const sf::Vector2u size = (*it)->second.image->getSize();
+            if ((size.x + 2 * AtlasPadding > maxPageSize) || (size.y + 2 * AtlasPadding > maxPageSize))
+            {
+                if ((*it)->second.texture.loadFromImage(*(*it)->second.image))
+                    imageUploaded(*it);
+                else
+                {
+                    m_ImageMap.erase(*it);
+                    success = false;
                 }
+
+                it = images.erase(it);
             }
+            else
+                ++it;
         }
-        else // The image doesn't exist yet
+
+        // The images are packed best when placing the highest images first
+        std::sort(images.begin(), images.end(), [](ImageMap::iterator left, ImageMap::iterator right)
+                                                { return left->second.image->getSize().y > right->second.image->getSize().y; });
+
+        std::vector<sf::Vector2u> sizes;
+        for (std::vector<ImageMap::iterator>::const_iterator it = images.begin(); it != images.end(); ++it)
+            sizes.push_back(sf::Vector2u((*it)->second.image->getSize().x + 2 * AtlasPadding, (*it)->second.image->getSize().y + 2 * AtlasPadding));
+
+        std::vector<ImageMap::iterator>::size_type first = 0;
+        while (first < images.size())
         {
-            auto it = m_ImageMap.insert(std::make_pair(filename, ImageMapData()));
-            imageIt = it.first;
+            std::vector<sf::Vector2u> positions;
+            const sf::Vector2u pageSize = planAtlasPage(std::vector<sf::Vector2u>(sizes.begin() + first, sizes.end()), maxPageSize, positions);
+
+            const std::vector<ImageMap::iterator>::size_type last = first + positions.size();
+
+            // A page is only useful when multiple images are placed on it
+            if (last - first > 1)
+            {
+                sf::Image pageImage;
+                pageImage.create(pageSize.x, pageSize.y, sf::Color::Transparent);
+                for (std::vector<ImageMap::iterator>::size_type i = first; i < last; ++i)
+                    pageImage.copy(*images[i]->second.image, positions[i - first].x + AtlasPadding, positions[i - first].y + AtlasPadding);
+
+                m_AtlasPages.push_back(AtlasPage());
+                AtlasPage& page = m_AtlasPages.back();
+                if (page.texture.loadFromImage(pageImage))
+                {
+                    for (std::vector<ImageMap::iterator>::size_type i = first; i < last; ++i)
+                    {
+                        const sf::Vector2u size = images[i]->second.image->getSize();
+
+                        images[i]->second.atlasPage = &page;
+                        images[i]->second.atlasPosition = sf::Vector2i(positions[i - first].x + AtlasPadding, positions[i - first].y + AtlasPadding);
+
+                        ++page.images;
+                        page.usedPixels += size.x * size.y;
+
+                        imageUploaded(images[i]);
+                    }
+
+                    first = last;
+                    continue;
+                }
+                else
+                    m_AtlasPages.pop_back();
+            }
+
+            // The images didn't end up on a page, so they get a texture of their own
+            for (std::vector<ImageMap::iterator>::size_type i = first; i < last; ++i)
+            {
+                if (images[i]->second.texture.loadFromImage(*images[i]->second.image))
+                    imageUploaded(images[i]);
+                else
+                {
+                    m_ImageMap.erase(images[i]);
+                    success = false;
+                }
+            }
+
+            first = last;
         }
 
-        // Add new data to the list
-        imageIt->second.data.push_back(TextureData());
-        texture.data = &imageIt->second.data.back();
-        texture.data->image = &imageIt->second.image;
-        texture.data->rect = rect;
+        return success;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::imageUploaded(ImageMap::iterator imageIt)
+    {
+        ImageMapData& imageData = imageIt->second;
+        imageData.size = imageData.image->getSize();
+
+        // Store one bit per pixel to be able to tell whether the pixel is transparent
+        const sf::Uint8* pixels = imageData.image->getPixelsPtr();
+        const std::size_t pixelCount = imageData.size.x * imageData.size.y;
+        imageData.alphaMask.resize(pixelCount);
+        for (std::size_t i = 0; i < pixelCount; ++i)
+            imageData.alphaMask[i] = (pixels[(i * 4) + 3] != 0);
+
+        // The repeated parts need the pixels, so they are created before the pixels are freed
+        createRepeatedParts(imageIt, *imageData.image);
 
-        // load the image
-        if (texture.data->image->loadFromFile(filename))
+        if (!m_KeepImagesInMemory)
+            imageData.image.reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::createRepeatedParts(ImageMap::iterator imageIt, const sf::Image& image)
+    {
+        std::map<std::string, std::vector<sf::IntRect>>::const_iterator partsIt = m_RepeatedParts.find(imageIt->first);
+        if (partsIt == m_RepeatedParts.end())
+            return;
+
+        for (std::vector<sf::IntRect>::const_iterator rectIt = partsIt->second.begin(); rectIt != partsIt->second.end(); ++rectIt)
         {
-            // Create a texture from the image
-            bool success;
-            if (rect == sf::IntRect(0, 0, 0, 0))
-                success = texture.data->texture.loadFromImage(*texture.data->image);
+            const sf::IntRect part = getPart(imageIt->second.size, *rectIt);
+
+            bool exists = false;
+            for (std::list<RepeatedPart>::const_iterator it = imageIt->second.repeatedParts.begin(); it != imageIt->second.repeatedParts.end(); ++it)
+            {
+                if (it->rect == part)
+                {
+                    exists = true;
+                    break;
+                }
+            }
+
+            if (exists)
+                continue;
+
+            imageIt->second.repeatedParts.push_back(RepeatedPart());
+            RepeatedPart& repeatedPart = imageIt->second.repeatedParts.back();
+            repeatedPart.rect = part;
+            if (repeatedPart.texture.loadFromImage(image, part))
+                repeatedPart.texture.setRepeated(true);
             else
-                success = texture.data->texture.loadFromImage(*texture.data->image, rect);
+                imageIt->second.repeatedParts.pop_back();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Texture* TextureManager::getRepeatedPart(ImageMap::iterator imageIt, const sf::IntRect& part)
+    {
+        ImageMapData& imageData = imageIt->second;
+        for (std::list<RepeatedPart>::iterator it = imageData.repeatedParts.begin(); it != imageData.repeatedParts.end(); ++it)
+        {
+            if (it->rect == part)
+                return &it->texture;
+        }
 
-            if (success)
+        // The part wasn't known to be repeated when the image was uploaded. This doesn't happen for images from config files.
+        m_RepeatedParts[imageIt->first].push_back(part);
+        if (imageData.image)
+            createRepeatedParts(imageIt, *imageData.image);
+        else
+        {
+            // The pixels were already freed, so the file is decoded again. Images that were never loaded from a file (e.g.
+            // the ones from a theme bundle) have to be read back from the graphics card instead.
+            sf::Image image;
+            if (image.loadFromFile(imageIt->first) && (image.getSize() == imageData.size))
+                createRepeatedParts(imageIt, image);
+            else
             {
-                // Set the texture in the sprite
-                texture.sprite.setTexture(texture.data->texture, true);
+                const sf::Texture& texture = (imageData.atlasPage != nullptr) ? imageData.atlasPage->texture : imageData.texture;
+                const sf::IntRect area = (imageData.atlasPage != nullptr)
+                                         ? sf::IntRect(imageData.atlasPosition.x, imageData.atlasPosition.y, imageData.size.x, imageData.size.y)
+                                         : sf::IntRect(0, 0, imageData.size.x, imageData.size.y);
 
-                // Set the other members of the data
-                texture.data->filename = filename;
-                texture.data->users = 1;
-                return true;
+                image.create(imageData.size.x, imageData.size.y);
+                image.copy(texture.copyToImage(), 0, 0, area);
+                createRepeatedParts(imageIt, image);
             }
         }
 
-        // The image couldn't be loaded
-        m_ImageMap.erase(imageIt);
-        texture.data = nullptr;
-        return false;
+        for (std::list<RepeatedPart>::iterator it = imageData.repeatedParts.begin(); it != imageData.repeatedParts.end(); ++it)
+        {
+            if (it->rect == part)
+                return &it->texture;
+        }
+
+        return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool TextureManager::copyTexture(const Texture& textureToCopy, Texture& newTexture)
+    TextureData* TextureManager::getTextureData(ImageMap::iterator imageIt, const sf::IntRect& part, bool repeated)
     {
-        // Ignore null pointers
-        if (textureToCopy.data == nullptr)
+        ImageMapData& imageData = imageIt->second;
+
+        // Loop all our textures to find out if this part was already in use
+        for (std::list<TextureData>::iterator it = imageData.data.begin(); it != imageData.data.end(); ++it)
         {
-            newTexture.data = nullptr;
-            return true;
+            // Only reuse the texture when the exact same part of the image is used. A part with a texture of its own was
+            // changed by the widget that uses it, so it isn't given to anyone else.
+            if ((it->rect == part) && (it->repeated == repeated) && (it->texture != &it->ownTexture))
+            {
+                // The texture is now used at multiple places
+                ++(it->users);
+                return &(*it);
+            }
+        }
+
+        // A repeated part is drawn from its own texture, other parts come from the atlas page or from the texture of the image
+        sf::Texture* texture;
+        sf::Vector2i offset;
+        if (repeated)
+        {
+            texture = getRepeatedPart(imageIt, part);
+            if (texture == nullptr)
+                return nullptr;
+        }
+        else if (imageData.atlasPage != nullptr)
+        {
+            texture = &imageData.atlasPage->texture;
+            offset = sf::Vector2i(imageData.atlasPosition.x + part.left, imageData.atlasPosition.y + part.top);
+        }
+        else
+        {
+            texture = &imageData.texture;
+            offset = sf::Vector2i(part.left, part.top);
         }
 
-        // Loop all our textures to check if we already have this one
-        for (auto imageIt = m_ImageMap.begin(); imageIt != m_ImageMap.end(); ++imageIt)
+        // Add new data to the list when this part wasn't used yet
+        imageData.data.push_back(TextureData());
+        TextureData* data = &imageData.data.back();
+        data->imageData = &imageData;
+        data->texture = texture;
+        data->repeated = repeated;
+        data->rect = part;
+        data->offset = offset;
+        data->filename = imageIt->first;
+        data->users = 1;
+        data->imageIt = imageIt;
+        data->dataIt = --imageData.data.end();
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::switchTextureData(Texture& texture, bool repeated)
+    {
+        sf::Lock lock(m_Mutex);
+
+        TextureData* oldData = texture.data;
+        TextureData* newData = getTextureData(oldData->imageIt, oldData->rect, repeated);
+        if (newData == nullptr)
+            return;
+
+        const sf::IntRect currentRect = texture.sprite.getTextureRect();
+        texture.data = newData;
+        texture.sprite.setTexture(*newData->texture);
+        texture.sprite.setTextureRect(sf::IntRect(currentRect.left - oldData->offset.x + newData->offset.x,
+                                                  currentRect.top - oldData->offset.y + newData->offset.y,
+                                                  currentRect.width, currentRect.height));
+
+        // The image is still used by the new data, so only the old data can be removed
+        if (--(oldData->users) == 0)
+            oldData->imageIt->second.data.erase(oldData->dataIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::IntRect TextureManager::getPart(const sf::Vector2u& imageSize, const sf::IntRect& rect)
+    {
+        // Find out which part of the image is needed (the same way as sf::Texture::loadFromImage does it)
+        sf::IntRect part;
+        if ((rect.width == 0) || (rect.height == 0)
+         || ((rect.left <= 0) && (rect.top <= 0) && (rect.width >= static_cast<int>(imageSize.x)) && (rect.height >= static_cast<int>(imageSize.y))))
+        {
+            part = sf::IntRect(0, 0, imageSize.x, imageSize.y);
+        }
+        else
         {
-            for (auto dataIt = imageIt->second.data.begin(); dataIt != imageIt->second.data.end(); ++dataIt)
+            part.left = std::max(rect.left, 0);
+            part.top = std::max(rect.top, 0);
+            part.width = std::min(rect.width, static_cast<int>(imageSize.x) - part.left);
+            part.height = std::min(rect.height, static_cast<int>(imageSize.y) - part.top);
+        }
+
+        return part;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::finishPreloadOfImage(const std::string& filename)
+    {
+        for (std::list<std::shared_ptr<PreloadJob>>::iterator it = m_Preloads.begin(); it != m_Preloads.end(); ++it)
+        {
+            if (std::find((*it)->filenames.begin(), (*it)->filenames.end(), filename) != (*it)->filenames.end())
+            {
+                PreloadHandle handle;
+                handle.m_Job = *it;
+                finishPreload(handle);
+                return;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setKeepImagesInMemory(bool keep)
+    {
+        sf::Lock lock(m_Mutex);
+
+        m_KeepImagesInMemory = keep;
+
+        if (!m_KeepImagesInMemory)
+        {
+            for (ImageMap::iterator imageIt = m_ImageMap.begin(); imageIt != m_ImageMap.end(); ++imageIt)
+                imageIt->second.image.reset();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getKeepImagesInMemory() const
+    {
+        sf::Lock lock(m_Mutex);
+
+        return m_KeepImagesInMemory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<ImageMemoryUsage> TextureManager::getMemoryUsage() const
+    {
+        sf::Lock lock(m_Mutex);
+
+        std::vector<ImageMemoryUsage> usage;
+        for (ImageMap::const_iterator imageIt = m_ImageMap.begin(); imageIt != m_ImageMap.end(); ++imageIt)
+        {
+            const ImageMapData& imageData = imageIt->second;
+            const std::size_t pixels = imageData.size.x * imageData.size.y;
+
+            ImageMemoryUsage info;
+            info.filename = imageIt->first;
+            info.cpuBytes = (imageData.alphaMask.size() + 7) / 8;
+            info.gpuBytes = pixels * 4;
+            info.users = 0;
+
+            if (imageData.image)
+                info.cpuBytes += pixels * 4;
+
+            for (std::list<RepeatedPart>::const_iterator it = imageData.repeatedParts.begin(); it != imageData.repeatedParts.end(); ++it)
+                info.gpuBytes += it->texture.getSize().x * it->texture.getSize().y * 4;
+
+            for (std::list<TextureData>::const_iterator it = imageData.data.begin(); it != imageData.data.end(); ++it)
+            {
+                if (it->texture == &it->ownTexture)
+                    info.gpuBytes += it->ownTexture.getSize().x * it->ownTexture.getSize().y * 4;
+
+                info.users += it->users;
+            }
+
+            usage.push_back(info);
+        }
+
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getTextureCount() const
+    {
+        sf::Lock lock(m_Mutex);
+
+        unsigned int count = m_AtlasPages.size();
+
+        for (ImageMap::const_iterator imageIt = m_ImageMap.begin(); imageIt != m_ImageMap.end(); ++imageIt)
+        {
+            if (imageIt->second.atlasPage == nullptr)
+                ++count;
+
+            count += imageIt->second.repeatedParts.size();
+
+            for (std::list<TextureData>::const_iterator it = imageIt->second.data.begin(); it != imageIt->second.data.end(); ++it)
             {
-                // Check if the pointer points to our texture
-                if (&(*dataIt) == textureToCopy.data)
+                if (it->texture == &it->ownTexture)
+                    ++count;
+            }
+        }
+
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextureManager::getAtlasFillRatio() const
+    {
+        sf::Lock lock(m_Mutex);
+
+        unsigned int usedPixels = 0;
+        unsigned int totalPixels = 0;
+        for (std::list<AtlasPage>::const_iterator it = m_AtlasPages.begin(); it != m_AtlasPages.end(); ++it)
+        {
+            usedPixels += it->usedPixels;
+            totalPixels += it->texture.getSize().x * it->texture.getSize().y;
+        }
+
+        if (totalPixels > 0)
+            return static_cast<float>(usedPixels) / totalPixels;
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u TextureManager::planAtlasPage(const std::vector<sf::Vector2u>& sizes, unsigned int maxPageSize, std::vector<sf::Vector2u>& positions)
+    {
+        unsigned int widest = 0;
+        unsigned int totalWidth = 0;
+        for (std::vector<sf::Vector2u>::const_iterator it = sizes.begin(); it != sizes.end(); ++it)
+        {
+            widest = std::max(widest, it->x);
+            totalWidth += it->x;
+        }
+
+        // Try different page widths and keep the one that fits the most images in the smallest area.
+        // Trying every possible width would take too long, so the width is increased in small steps.
+        positions.clear();
+        sf::Vector2u pageSize;
+        for (unsigned int width = widest; (width <= maxPageSize) && (width < totalWidth + 8); width += 8)
+        {
+            std::vector<sf::Vector2u> newPositions;
+            sf::Vector2u newPageSize;
+            packImages(sizes, width, maxPageSize, newPositions, newPageSize);
+
+            if ((newPositions.size() > positions.size())
+             || ((newPositions.size() == positions.size()) && (newPageSize.x * newPageSize.y < pageSize.x * pageSize.y)))
+            {
+                positions = newPositions;
+                pageSize = newPageSize;
+            }
+        }
+
+        return pageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::packImages(const std::vector<sf::Vector2u>& sizes, unsigned int pageWidth, unsigned int maxPageHeight,
+                                    std::vector<sf::Vector2u>& positions, sf::Vector2u& usedSize)
+    {
+        // The skyline is the upper edge of the area that is already filled, stored as horizontal segments from left to right
+        struct Segment
+        {
+            unsigned int x;
+            unsigned int y;
+            unsigned int width;
+        };
+
+        std::vector<Segment> skyline;
+        skyline.push_back({0, 0, pageWidth});
+
+        positions.clear();
+        usedSize = sf::Vector2u(0, 0);
+
+        // The images are placed in order, until one no longer fits on the page
+        for (std::vector<sf::Vector2u>::const_iterator size = sizes.begin(); size != sizes.end(); ++size)
+        {
+            // Find the lowest place on the skyline where the image fits (the most left one when there are multiple)
+            bool found = false;
+            sf::Vector2u position;
+            for (std::vector<Segment>::size_type i = 0; (i < skyline.size()) && (skyline[i].x + size->x <= pageWidth); ++i)
+            {
+                // The image rests on the highest segment below it
+                unsigned int y = 0;
+                unsigned int coveredWidth = 0;
+                for (std::vector<Segment>::size_type j = i; coveredWidth < size->x; ++j)
+                {
+                    y = std::max(y, skyline[j].y);
+                    coveredWidth += skyline[j].width;
+                }
+
+                if ((y + size->y <= maxPageHeight) && (!found || (y < position.y)))
                 {
-                    // The texture is now used at multiple places
-                    ++(dataIt->users);
-                    newTexture = textureToCopy;
-                    return true;
+                    position = sf::Vector2u(skyline[i].x, y);
+                    found = true;
                 }
             }
-        }
 
-        TGUI_OUTPUT("TGUI warning: Can't copy texture that wasn't loaded by TextureManager.");
-        return false;
+            if (!found)
+                break;
+
+            positions.push_back(position);
+            usedSize.x = std::max(usedSize.x, position.x + size->x);
+            usedSize.y = std::max(usedSize.y, position.y + size->y);
+
+            // Raise the part of the skyline that is now covered by the image
+            const Segment placed = {position.x, position.y + size->y, size->x};
+            std::vector<Segment> newSkyline;
+            for (std::vector<Segment>::const_iterator it = skyline.begin(); it != skyline.end(); ++it)
+            {
+                if (it->x + it->width <= placed.x)
+                    newSkyline.push_back(*it);
+                else if (it->x >= placed.x + placed.width)
+                {
+                    if (newSkyline.empty() || (newSkyline.back().x < placed.x))
+                        newSkyline.push_back(placed);
+
+                    newSkyline.push_back(*it);
+                }
+                else
+                {
+                    if (it->x < placed.x)
+                        newSkyline.push_back({it->x, it->y, placed.x - it->x});
+
+                    if (newSkyline.empty() || (newSkyline.back().x < placed.x))
+                        newSkyline.push_back(placed);
+
+                    if (it->x + it->width > placed.x + placed.width)
+                        newSkyline.push_back({placed.x + placed.width, it->y, it->x + it->width - placed.x - placed.width});
+                }
+            }
+
+            // Merge neighbouring segments of the same height
+            skyline.clear();
+            for (std::vector<Segment>::const_iterator it = newSkyline.begin(); it != newSkyline.end(); ++it)
+            {
+                if (!skyline.empty() && (skyline.back().y == it->y))
+                    skyline.back().width += it->width;
+                else
+                    skyline.push_back(*it);
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(Texture& textureToRemove)
+    void TextureManager::removeImage(ImageMap::iterator imageIt)
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_ImageMap.begin(); imageIt != m_ImageMap.end(); ++imageIt)
+        // Remove the image from its atlas page, and remove the page when it no longer contains any images
+        AtlasPage* page = imageIt->second.atlasPage;
+        if (page != nullptr)
         {
-            for (auto dataIt = imageIt->second.data.begin(); dataIt != imageIt->second.data.end(); ++dataIt)
+            page->usedPixels -= imageIt->second.size.x * imageIt->second.size.y;
+            if (--(page->images) == 0)
             {
-                // Check if the pointer points to our texture
-                if (&(*dataIt) == textureToRemove.data)
+                for (std::list<AtlasPage>::iterator it = m_AtlasPages.begin(); it != m_AtlasPages.end(); ++it)
                 {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
+                    if (&(*it) == page)
                     {
-                        // Remove the texture from the list, or even the whole image if it isn't used anywhere else
-                        int usage = std::count_if(imageIt->second.data.begin(), imageIt->second.data.end(), [dataIt](TextureData& data){ return data.image == dataIt->image; });
-                        if (usage == 1)
-                            m_ImageMap.erase(imageIt);
-                        else
-                            imageIt->second.data.erase(dataIt);
+                        m_AtlasPages.erase(it);
+                        break;
                     }
-
-                    // The pointer is now useless
-                    textureToRemove.data = nullptr;
-                    return;
                 }
             }
         }
 
-        TGUI_OUTPUT("TGUI warning: Can't remove texture that wasn't loaded by TextureManager.");
-        return;
+        m_ImageMap.erase(imageIt);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,651 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/ThemeBundle.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+
+#ifdef SFML_SYSTEM_WINDOWS
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    const char ThemeBundle::Magic[8] = {'T', 'G', 'U', 'I', 'B', 'N', 'D', 'L'};
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MappedFile::MappedFile() :
+    m_Data(nullptr),
+    m_Size(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::open(const std::string& filename)
+    {
+        close();
+
+    #ifdef SFML_SYSTEM_WINDOWS
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || (size.QuadPart == 0))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // The view keeps the file mapped, the handles are no longer needed once it exists
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr)
+        {
+            m_Data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+
+        if (m_Data == nullptr)
+            return false;
+
+        m_Size = static_cast<std::size_t>(size.QuadPart);
+    #else
+        int file = ::open(filename.c_str(), O_RDONLY);
+        if (file == -1)
+            return false;
+
+        struct stat info;
+        if ((fstat(file, &info) == -1) || (info.st_size == 0))
+        {
+            ::close(file);
+            return false;
+        }
+
+        // The mapping remains valid after the file is closed
+        void* data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+
+        if (data == MAP_FAILED)
+            return false;
+
+        m_Data = static_cast<const char*>(data);
+        m_Size = static_cast<std::size_t>(info.st_size);
+    #endif
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedFile::close()
+    {
+        if (m_Data == nullptr)
+            return;
+
+    #ifdef SFML_SYSTEM_WINDOWS
+        UnmapViewOfFile(m_Data);
+    #else
+        munmap(const_cast<char*>(m_Data), m_Size);
+    #endif
+
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* MappedFile::getData() const
+    {
+        return m_Data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedFile::getSize() const
+    {
+        return m_Size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThemeBundle::compile(const std::string& configFilename, const std::string& bundleFilename)
+    {
+        // All filenames in the bundle are relative to the folder of the config file
+        std::string rootFolder = "";
+        std::string::size_type slashPos = configFilename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            rootFolder = configFilename.substr(0, slashPos+1);
+
+        std::map<std::string, std::map<std::string, ConfigSection>> configFiles;
+        if (!readConfigFiles(rootFolder, configFilename.substr(rootFolder.length()), configFiles))
+            return false;
+
+        // Find all images that are used (the filenames in the values are relative to the config file that contains them)
+        std::set<std::string> usedImages;
+        for (auto fileIt = configFiles.begin(); fileIt != configFiles.end(); ++fileIt)
+        {
+            std::string folder = "";
+            slashPos = fileIt->first.find_last_of("/\\");
+            if (slashPos != std::string::npos)
+                folder = fileIt->first.substr(0, slashPos+1);
+
+            for (auto sectionIt = fileIt->second.begin(); sectionIt != fileIt->second.end(); ++sectionIt)
+            {
+                const std::vector<ConfigValue>& values = sectionIt->second.values;
+                for (std::vector<ConfigValue>::const_iterator valueIt = values.begin(); valueIt != values.end(); ++valueIt)
+                {
+                    if (valueIt->isTexture && !isConfigFilename(valueIt->filename))
+                        usedImages.insert(folder + valueIt->filename);
+                }
+            }
+        }
+
+        // Decode the images
+        const std::vector<std::string> imageFilenames(usedImages.begin(), usedImages.end());
+        std::vector<sf::Image> images(imageFilenames.size());
+        for (unsigned int i = 0; i < imageFilenames.size(); ++i)
+        {
+            if (!images[i].loadFromFile(rootFolder + imageFilenames[i]))
+            {
+                TGUI_OUTPUT("TGUI error: Failed to load " + rootFolder + imageFilenames[i] + ".");
+                return false;
+            }
+        }
+
+        // The images are packed best when placing the highest images first
+        std::vector<unsigned int> order;
+        for (unsigned int i = 0; i < images.size(); ++i)
+            order.push_back(i);
+
+        std::sort(order.begin(), order.end(), [&images](unsigned int left, unsigned int right)
+                                              { return images[left].getSize().y > images[right].getSize().y; });
+
+        std::vector<sf::Vector2u> sizes;
+        for (std::vector<unsigned int>::const_iterator it = order.begin(); it != order.end(); ++it)
+            sizes.push_back(sf::Vector2u(images[*it].getSize().x + 2 * TextureManager::AtlasPadding, images[*it].getSize().y + 2 * TextureManager::AtlasPadding));
+
+        // Pack the images on pages in the same way as the texture manager would do it
+        std::vector<sf::Image> pages;
+        std::vector<unsigned int> imagePages(images.size());
+        std::vector<sf::Vector2u> imagePositions(images.size());
+        std::vector<unsigned int>::size_type first = 0;
+        while (first < order.size())
+        {
+            std::vector<sf::Vector2u> positions;
+            sf::Vector2u pageSize = TextureManager::planAtlasPage(std::vector<sf::Vector2u>(sizes.begin() + first, sizes.end()),
+                                                                  TextureManager::MaxAtlasPageSize, positions);
+
+            // An image that is too big for a page gets a page of its own
+            if (positions.empty())
+            {
+                positions.push_back(sf::Vector2u(0, 0));
+                pageSize = sizes[first];
+            }
+
+            pages.push_back(sf::Image());
+            pages.back().create(pageSize.x, pageSize.y, sf::Color::Transparent);
+            for (std::vector<sf::Vector2u>::size_type i = 0; i < positions.size(); ++i)
+            {
+                const unsigned int image = order[first + i];
+                imagePages[image] = pages.size() - 1;
+                imagePositions[image] = sf::Vector2u(positions[i].x + TextureManager::AtlasPadding, positions[i].y + TextureManager::AtlasPadding);
+                pages.back().copy(images[image], imagePositions[image].x, imagePositions[image].y);
+            }
+
+            first += positions.size();
+        }
+
+        std::ofstream file(bundleFilename.c_str(), std::ofstream::out | std::ofstream::binary);
+        if (!file.is_open())
+        {
+            TGUI_OUTPUT("TGUI error: Failed to open " + bundleFilename + " for writing.");
+            return false;
+        }
+
+        file.write(Magic, sizeof(Magic));
+        writeUint32(file, Version);
+
+        // Write the size of the pages, their pixels are stored at the end of the file
+        writeUint32(file, pages.size());
+        for (std::vector<sf::Image>::const_iterator it = pages.begin(); it != pages.end(); ++it)
+        {
+            writeUint32(file, it->getSize().x);
+            writeUint32(file, it->getSize().y);
+        }
+
+        // Write where every image is placed
+        writeUint32(file, imageFilenames.size());
+        for (unsigned int i = 0; i < imageFilenames.size(); ++i)
+        {
+            writeString(file, imageFilenames[i]);
+            writeUint32(file, imagePages[i]);
+            writeUint32(file, imagePositions[i].x);
+            writeUint32(file, imagePositions[i].y);
+            writeUint32(file, images[i].getSize().x);
+            writeUint32(file, images[i].getSize().y);
+        }
+
+        // Write the parsed config files
+        writeUint32(file, configFiles.size());
+        for (auto fileIt = configFiles.begin(); fileIt != configFiles.end(); ++fileIt)
+        {
+            writeString(file, fileIt->first);
+            writeUint32(file, fileIt->second.size());
+            for (auto sectionIt = fileIt->second.begin(); sectionIt != fileIt->second.end(); ++sectionIt)
+            {
+                const ConfigSection& section = sectionIt->second;
+
+                writeString(file, sectionIt->first);
+                writeUint32(file, section.properties.size());
+                for (unsigned int i = 0; i < section.properties.size(); ++i)
+                {
+                    const ConfigValue& value = section.values[i];
+
+                    writeString(file, section.properties[i]);
+                    writeString(file, value.string);
+                    writeUint32(file, (value.isBool ? 1 : 0) | (value.boolValue ? 2 : 0) | (value.isBorders ? 4 : 0) | (value.isTexture ? 8 : 0));
+                    writeUint32(file, (value.color.r << 24) | (value.color.g << 16) | (value.color.b << 8) | value.color.a);
+                    writeUint32(file, value.borders.left);
+                    writeUint32(file, value.borders.top);
+                    writeUint32(file, value.borders.right);
+                    writeUint32(file, value.borders.bottom);
+                    writeString(file, value.filename);
+                    writeUint32(file, static_cast<sf::Uint32>(value.textureRect.left));
+                    writeUint32(file, static_cast<sf::Uint32>(value.textureRect.top));
+                    writeUint32(file, static_cast<sf::Uint32>(value.textureRect.width));
+                    writeUint32(file, static_cast<sf::Uint32>(value.textureRect.height));
+                }
+            }
+        }
+
+        // Write the pixels of the pages, so that they can be uploaded without decoding anything
+        for (std::vector<sf::Image>::const_iterator it = pages.begin(); it != pages.end(); ++it)
+            file.write(reinterpret_cast<const char*>(it->getPixelsPtr()), it->getSize().x * it->getSize().y * 4);
+
+        if (!file)
+        {
+            TGUI_OUTPUT("TGUI error: Failed to write " + bundleFilename + ".");
+            return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThemeBundle::load(const std::string& bundleFilename, const std::string& themeFolder)
+    {
+        MappedFile file;
+        if (!file.open(bundleFilename))
+        {
+            TGUI_OUTPUT("TGUI error: Failed to open " + bundleFilename + ".");
+            return false;
+        }
+
+        const char* data = file.getData();
+        const char* end = data + file.getSize();
+
+        sf::Uint32 version = 0;
+        if ((file.getSize() < sizeof(Magic)) || (std::memcmp(data, Magic, sizeof(Magic)) != 0))
+        {
+            TGUI_OUTPUT("TGUI error: " + bundleFilename + " is not a theme bundle.");
+            return false;
+        }
+
+        data += sizeof(Magic);
+        if (!readUint32(data, end, version) || (version != Version))
+        {
+            TGUI_OUTPUT("TGUI error: " + bundleFilename + " was compiled for a different version of tgui.");
+            return false;
+        }
+
+        // Read the size of the pages
+        bool valid = true;
+        sf::Uint32 count = 0;
+        std::vector<sf::Vector2u> pageSizes;
+        valid = readUint32(data, end, count);
+        for (sf::Uint32 i = 0; valid && (i < count); ++i)
+        {
+            sf::Uint32 width;
+            sf::Uint32 height;
+            valid = readUint32(data, end, width) && readUint32(data, end, height) && (width > 0) && (height > 0);
+            pageSizes.push_back(sf::Vector2u(width, height));
+        }
+
+        // Read where the images are placed
+        std::vector<std::string> imageFilenames;
+        std::vector<sf::Uint32> imagePages;
+        std::vector<sf::IntRect> imageRects;
+        valid = valid && readUint32(data, end, count);
+        for (sf::Uint32 i = 0; valid && (i < count); ++i)
+        {
+            std::string filename;
+            sf::Uint32 page, left, top, width, height;
+            valid = readString(data, end, filename) && readUint32(data, end, page)
+                 && readUint32(data, end, left) && readUint32(data, end, top) && readUint32(data, end, width) && readUint32(data, end, height)
+                 && (page < pageSizes.size())
+                 && (width <= pageSizes[page].x) && (left <= pageSizes[page].x - width)
+                 && (height <= pageSizes[page].y) && (top <= pageSizes[page].y - height);
+
+            imageFilenames.push_back(filename);
+            imagePages.push_back(page);
+            imageRects.push_back(sf::IntRect(left, top, width, height));
+        }
+
+        // Read the parsed config files
+        std::map<std::string, std::map<std::string, ConfigSection>> configFiles;
+        valid = valid && readUint32(data, end, count);
+        for (sf::Uint32 i = 0; valid && (i < count); ++i)
+        {
+            std::string filename;
+            sf::Uint32 sectionCount = 0;
+            valid = readString(data, end, filename) && readUint32(data, end, sectionCount);
+
+            std::map<std::string, ConfigSection>& sections = configFiles[filename];
+            for (sf::Uint32 j = 0; valid && (j < sectionCount); ++j)
+            {
+                std::string sectionName;
+                sf::Uint32 valueCount = 0;
+                valid = readString(data, end, sectionName) && readUint32(data, end, valueCount);
+
+                ConfigSection& section = sections[sectionName];
+                for (sf::Uint32 k = 0; valid && (k < valueCount); ++k)
+                {
+                    std::string property;
+                    ConfigValue value;
+                    sf::Uint32 flags, color, left, top, width, height;
+                    valid = readString(data, end, property) && readString(data, end, value.string)
+                         && readUint32(data, end, flags) && readUint32(data, end, color)
+                         && readUint32(data, end, value.borders.left) && readUint32(data, end, value.borders.top)
+                         && readUint32(data, end, value.borders.right) && readUint32(data, end, value.borders.bottom)
+                         && readString(data, end, value.filename)
+                         && readUint32(data, end, left) && readUint32(data, end, top) && readUint32(data, end, width) && readUint32(data, end, height);
+
+                    if (valid)
+                    {
+                        value.isBool = ((flags & 1) != 0);
+                        value.boolValue = ((flags & 2) != 0);
+                        value.isBorders = ((flags & 4) != 0);
+                        value.isTexture = ((flags & 8) != 0);
+                        value.color = sf::Color(color >> 24, (color >> 16) & 0xff, (color >> 8) & 0xff, color & 0xff);
+                        value.textureRect = sf::IntRect(static_cast<int>(left), static_cast<int>(top), static_cast<int>(width), static_cast<int>(height));
+
+                        section.properties.push_back(property);
+                        section.values.push_back(value);
+                    }
+                }
+            }
+        }
+
+        // The pixels of the pages are stored behind the contents
+        std::vector<const sf::Uint8*> pagePixels;
+        for (std::vector<sf::Vector2u>::const_iterator it = pageSizes.begin(); valid && (it != pageSizes.end()); ++it)
+        {
+            const sf::Uint64 pageBytes = static_cast<sf::Uint64>(it->x) * it->y * 4;
+            if (pageBytes <= static_cast<sf::Uint64>(end - data))
+            {
+                pagePixels.push_back(reinterpret_cast<const sf::Uint8*>(data));
+                data += pageBytes;
+            }
+            else
+                valid = false;
+        }
+
+        if (!valid)
+        {
+            TGUI_OUTPUT("TGUI error: " + bundleFilename + " is corrupt.");
+            return false;
+        }
+
+        // The config file cache is always locked before the texture manager
+        sf::Lock configLock(ConfigFile::m_CacheMutex);
+        sf::Lock textureLock(TGUI_TextureManager.m_Mutex);
+
+        // The repeated parts get their texture while the pixels of the page are still available
+        for (auto fileIt = configFiles.begin(); fileIt != configFiles.end(); ++fileIt)
+            ConfigFile::addRepeatedParts(themeFolder + fileIt->first, fileIt->second);
+
+        bool success = true;
+        std::vector<AtlasPage*> pages(pageSizes.size(), nullptr);
+        std::vector<bool> failedPages(pageSizes.size(), false);
+        for (unsigned int i = 0; i < imageFilenames.size(); ++i)
+        {
+            const std::string filename = themeFolder + imageFilenames[i];
+            const sf::Uint32 pageIndex = imagePages[i];
+            const sf::IntRect& rect = imageRects[i];
+
+            // Images that were already loaded are left untouched
+            TGUI_TextureManager.finishPreloadOfImage(filename);
+            if (TGUI_TextureManager.m_ImageMap.find(filename) != TGUI_TextureManager.m_ImageMap.end())
+                continue;
+
+            if (failedPages[pageIndex])
+                continue;
+
+            // A page is only uploaded when at least one of its images is used, the pixels come straight from the mapped file
+            if (pages[pageIndex] == nullptr)
+            {
+                TGUI_TextureManager.m_AtlasPages.push_back(AtlasPage());
+                AtlasPage& page = TGUI_TextureManager.m_AtlasPages.back();
+                if (!page.texture.create(pageSizes[pageIndex].x, pageSizes[pageIndex].y))
+                {
+                    TGUI_OUTPUT("TGUI error: Failed to create a texture of " + to_string(pageSizes[pageIndex].x) + "x"
+                                + to_string(pageSizes[pageIndex].y) + " for " + bundleFilename + ".");
+
+                    TGUI_TextureManager.m_AtlasPages.pop_back();
+                    failedPages[pageIndex] = true;
+                    success = false;
+                    continue;
+                }
+
+                page.texture.update(pagePixels[pageIndex]);
+                pages[pageIndex] = &page;
+            }
+
+            ImageMap::iterator imageIt = TGUI_TextureManager.m_ImageMap.insert(std::make_pair(filename, ImageMapData())).first;
+            ImageMapData& imageData = imageIt->second;
+            imageData.size = sf::Vector2u(rect.width, rect.height);
+            imageData.atlasPage = pages[pageIndex];
+            imageData.atlasPosition = sf::Vector2i(rect.left, rect.top);
+
+            ++(pages[pageIndex]->images);
+            pages[pageIndex]->usedPixels += rect.width * rect.height;
+
+            // Create the alpha mask and the image from the part of the page that contains the image
+            const bool hasRepeatedParts = (TGUI_TextureManager.m_RepeatedParts.find(filename) != TGUI_TextureManager.m_RepeatedParts.end());
+            const bool needsPixels = TGUI_TextureManager.m_KeepImagesInMemory || hasRepeatedParts;
+            const unsigned int pageWidth = pageSizes[pageIndex].x;
+            std::vector<sf::Uint8> imagePixels;
+            imageData.alphaMask.resize(rect.width * rect.height);
+            for (int y = 0; y < rect.height; ++y)
+            {
+                const sf::Uint8* row = pagePixels[pageIndex] + ((rect.top + y) * pageWidth + rect.left) * 4;
+                for (int x = 0; x < rect.width; ++x)
+                    imageData.alphaMask[y * rect.width + x] = (row[(x * 4) + 3] != 0);
+
+                if (needsPixels)
+                    imagePixels.insert(imagePixels.end(), row, row + rect.width * 4);
+            }
+
+            if (needsPixels)
+            {
+                imageData.image.reset(new sf::Image());
+                imageData.image->create(rect.width, rect.height, imagePixels.data());
+
+                if (hasRepeatedParts)
+                    TGUI_TextureManager.createRepeatedParts(imageIt, *imageData.image);
+
+                if (!TGUI_TextureManager.m_KeepImagesInMemory)
+                    imageData.image.reset();
+            }
+        }
+
+        // Put the config files in the cache, unless they were already loaded
+        for (auto fileIt = configFiles.begin(); fileIt != configFiles.end(); ++fileIt)
+            ConfigFile::m_Cache.insert(std::make_pair(themeFolder + fileIt->first, fileIt->second));
+
+        return success;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThemeBundle::readConfigFiles(const std::string& rootFolder, const std::string& configFilename,
+                                      std::map<std::string, std::map<std::string, ConfigSection>>& configFiles)
+    {
+        std::vector<std::string> filesToRead(1, configFilename);
+        while (!filesToRead.empty())
+        {
+            const std::string filename = filesToRead.back();
+            filesToRead.pop_back();
+
+            // A config file can be referenced multiple times
+            if (configFiles.find(filename) != configFiles.end())
+                continue;
+
+            ConfigFile configFile;
+            if (!configFile.open(rootFolder + filename))
+            {
+                TGUI_OUTPUT("TGUI error: Failed to open " + rootFolder + filename + ".");
+                return false;
+            }
+
+            std::map<std::string, ConfigSection>& sections = configFiles[filename];
+            {
+                sf::Lock lock(ConfigFile::m_CacheMutex);
+
+                // When the file isn't cached then it is parsed without being added to the cache, as the widgets will never be loaded from it here
+                if (configFile.m_CachedFile != nullptr)
+                    sections = *configFile.m_CachedFile;
+                else
+                {
+                    configFile.m_CachedFile = &sections;
+                    const bool parsed = configFile.readAndCache();
+                    configFile.m_CachedFile = nullptr;
+
+                    if (!parsed)
+                    {
+                        TGUI_OUTPUT("TGUI error: Failed to parse " + rootFolder + filename + ".");
+                        return false;
+                    }
+                }
+            }
+
+            // Other config files are referenced relative to the folder of this config file
+            std::string folder = "";
+            std::string::size_type slashPos = filename.find_last_of("/\\");
+            if (slashPos != std::string::npos)
+                folder = filename.substr(0, slashPos+1);
+
+            for (auto sectionIt = sections.begin(); sectionIt != sections.end(); ++sectionIt)
+            {
+                const std::vector<ConfigValue>& values = sectionIt->second.values;
+                for (std::vector<ConfigValue>::const_iterator valueIt = values.begin(); valueIt != values.end(); ++valueIt)
+                {
+                    if (valueIt->isTexture && isConfigFilename(valueIt->filename))
+                        filesToRead.push_back(folder + valueIt->filename);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThemeBundle::isConfigFilename(const std::string& filename)
+    {
+        return (filename.length() >= 5) && (toLower(filename.substr(filename.length() - 5)) == ".conf");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThemeBundle::writeUint32(std::ofstream& file, sf::Uint32 value)
+    {
+        const char bytes[4] = {static_cast<char>(value & 0xff), static_cast<char>((value >> 8) & 0xff),
+                               static_cast<char>((value >> 16) & 0xff), static_cast<char>((value >> 24) & 0xff)};
+        file.write(bytes, 4);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThemeBundle::writeString(std::ofstream& file, const std::string& value)
+    {
+        writeUint32(file, value.length());
+        file.write(value.data(), value.length());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThemeBundle::readUint32(const char*& data, const char* end, sf::Uint32& value)
+    {
+        if (end - data < 4)
+            return false;
+
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+        value = static_cast<sf::Uint32>(bytes[0]) | (static_cast<sf::Uint32>(bytes[1]) << 8)
+              | (static_cast<sf::Uint32>(bytes[2]) << 16) | (static_cast<sf::Uint32>(bytes[3]) << 24);
+
+        data += 4;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThemeBundle::readString(const char*& data, const char* end, std::string& value)
+    {
+        sf::Uint32 length;
+        if (!readUint32(data, end, length) || (static_cast<std::size_t>(end - data) < length))
+            return false;
+
+        value.assign(data, length);
+        data += length;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
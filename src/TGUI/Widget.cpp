@@ -26,11 +26,28 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/SharedWidgetPtr.inl>
 #include <TGUI/Container.hpp>
+#include <TGUI/WidgetArena.hpp>
+
+#include <new>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+
+    namespace
+    {
+        // Stored in front of every widget that is allocated with new, so that delete knows where the memory came from.
+        // The header takes 16 bytes to keep the widget aligned like memory returned by the global operator new.
+        struct AllocationHeader
+        {
+            WidgetArena* arena;
+            std::size_t  size;
+        };
+
+        const std::size_t AllocationHeaderSize = 16;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Widget() :
@@ -39,14 +56,18 @@ namespace tgui
     m_Loaded         (false),
     m_WidgetPhase    (0),
     m_Parent         (nullptr),
+    m_ContainerSlot  (0),
     m_Opacity        (255),
     m_MouseHover     (false),
     m_MouseDown      (false),
     m_Focused        (false),
     m_AllowFocus     (false),
+    m_TabIndex       (0),
     m_AnimatedWidget (false),
     m_DraggableWidget(false),
-    m_ContainerWidget(false)
+    m_ContainerWidget(false),
+    m_ReferenceCount (0),
+    m_WeakReference  (nullptr)
     {
         m_Callback.widget = nullptr;
         m_Callback.widgetType = Type_Unknown;
@@ -64,14 +85,18 @@ namespace tgui
     m_Loaded         (copy.m_Loaded),
     m_WidgetPhase    (copy.m_WidgetPhase),
     m_Parent         (copy.m_Parent),
+    m_ContainerSlot  (0),
     m_Opacity        (copy.m_Opacity),
     m_MouseHover     (false),
     m_MouseDown      (false),
     m_Focused        (false),
     m_AllowFocus     (copy.m_AllowFocus),
+    m_TabIndex       (copy.m_TabIndex),
     m_AnimatedWidget (copy.m_AnimatedWidget),
     m_DraggableWidget(copy.m_DraggableWidget),
-    m_ContainerWidget(copy.m_ContainerWidget)
+    m_ContainerWidget(copy.m_ContainerWidget),
+    m_ReferenceCount (0),
+    m_WeakReference  (nullptr)
     {
         m_Callback.widget = nullptr;
     }
@@ -80,6 +105,22 @@ namespace tgui
 
     Widget::~Widget()
     {
+        // Let the weak pointers know that the widget no longer exists
+        WeakWidgetReference* reference = m_WeakReference;
+        if (reference != nullptr)
+        {
+#ifdef TGUI_USE_ATOMIC_REFCOUNT
+            // Wait for weak pointers that are still checking the reference count of this widget in another thread
+            {
+                std::lock_guard<std::mutex> lock(reference->mutex);
+                reference->widget = nullptr;
+            }
+#else
+            reference->widget = nullptr;
+#endif
+            if (--reference->count == 0)
+                delete reference;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -103,6 +144,7 @@ namespace tgui
             m_MouseDown           = false;
             m_Focused             = false;
             m_AllowFocus          = right.m_AllowFocus;
+            m_TabIndex            = right.m_TabIndex;
             m_AnimatedWidget      = right.m_AnimatedWidget;
             m_DraggableWidget     = right.m_DraggableWidget;
             m_ContainerWidget     = right.m_ContainerWidget;
@@ -117,6 +159,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void* Widget::operator new(std::size_t size)
+    {
+        return operator new(size, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* Widget::operator new(std::size_t size, WidgetArena* arena)
+    {
+        char* memory;
+        if (arena != nullptr)
+            memory = static_cast<char*>(arena->allocate(size + AllocationHeaderSize));
+        else
+            memory = static_cast<char*>(::operator new(size + AllocationHeaderSize));
+
+        AllocationHeader* header = reinterpret_cast<AllocationHeader*>(memory);
+        header->arena = arena;
+        header->size = size + AllocationHeaderSize;
+
+        return memory + AllocationHeaderSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::operator delete(void* memory)
+    {
+        if (memory == nullptr)
+            return;
+
+        char* start = static_cast<char*>(memory) - AllocationHeaderSize;
+        AllocationHeader* header = reinterpret_cast<AllocationHeader*>(start);
+
+        if (header->arena != nullptr)
+            header->arena->deallocate(start, header->size);
+        else
+            ::operator delete(start);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::operator delete(void* memory, WidgetArena*)
+    {
+        operator delete(memory);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::Vector2f Widget::getAbsolutePosition() const
     {
         if (m_Parent)
@@ -130,6 +219,8 @@ namespace tgui
     void Widget::show()
     {
         m_Visible = true;
+        focusableChanged();
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,6 +228,8 @@ namespace tgui
     void Widget::hide()
     {
         m_Visible = false;
+        focusableChanged();
+        appearanceChanged();
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -154,6 +247,8 @@ namespace tgui
     void Widget::enable()
     {
         m_Enabled = true;
+        focusableChanged();
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,6 +256,8 @@ namespace tgui
     void Widget::disable()
     {
         m_Enabled = false;
+        focusableChanged();
+        appearanceChanged();
 
         // Change the mouse button state.
         m_MouseHover = false;
@@ -203,7 +300,7 @@ namespace tgui
 
     void Widget::unfocus()
     {
-        if (m_Focused)
+        if (m_Focused && m_Parent)
             m_Parent->unfocusWidgets();
     }
 
@@ -216,6 +313,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setTabIndex(int tabIndex)
+    {
+        m_TabIndex = tabIndex;
+        focusableChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int Widget::getTabIndex() const
+    {
+        return m_TabIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     WidgetTypes Widget::getWidgetType() const
     {
         return m_Callback.widgetType;
@@ -233,6 +345,7 @@ namespace tgui
     void Widget::setTransparency(unsigned char transparency)
     {
         m_Opacity = transparency;
+        appearanceChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -246,14 +359,16 @@ namespace tgui
 
     void Widget::moveToFront()
     {
-        m_Parent->moveWidgetToFront(this);
+        if (m_Parent)
+            m_Parent->moveWidgetToFront(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::moveToBack()
     {
-        m_Parent->moveWidgetToBack(this);
+        if (m_Parent)
+            m_Parent->moveWidgetToBack(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,25 +393,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::getTimeUntilUpdate(sf::Time&) const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::addCallback()
     {
-        // Loop through all callback functions
-        auto& functions = m_CallbackFunctions[m_Callback.trigger];
-        for (auto func = functions.cbegin(); func != functions.cend(); ++func)
+        if ((m_BoundTriggers & m_Callback.trigger) == 0)
+            return;
+
+        // A function is allowed to bind or unbind callbacks of this widget. The list isn't changed until the last function
+        // has returned: functions that are bound now are only called for the next callback, unbound ones are only marked.
+        const unsigned int trigger = m_Callback.trigger;
+        const unsigned int unbindCount = m_UnbindCount;
+        const std::vector<CallbackFunction>::size_type functionCount = m_CallbackFunctions.size();
+
+        ++m_SendingCallbacks;
+
+        // Pass the callback to the correct place
+        for (std::vector<CallbackFunction>::size_type i = 0; i < functionCount; ++i)
         {
-            // Pass the callback to the correct place
-            if (*func != nullptr)
-                (*func)();
-            else
+            // Functions that were unbound by an earlier callback are skipped, the ones unbound during this callback are still called
+            const CallbackFunction& callbackFunction = m_CallbackFunctions[i];
+            if ((callbackFunction.trigger != trigger) || ((callbackFunction.unbound != 0) && (callbackFunction.unbound <= unbindCount)))
+                continue;
+
+            if (callbackFunction.function != nullptr)
+                callbackFunction.function();
+            else if (m_Parent)
                 m_Parent->addChildCallback(m_Callback);
         }
+
+        if (--m_SendingCallbacks == 0)
+            applyDeferredBindings();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::mouseEnteredWidget()
     {
-        if (m_CallbackFunctions[MouseEntered].empty() == false)
+        // Only widgets with hover images look different now
+        if (m_WidgetPhase & WidgetPhase_Hover)
+            appearanceChanged();
+
+        if (isCallbackBound(MouseEntered))
         {
             m_Callback.trigger = MouseEntered;
             addCallback();
@@ -307,7 +450,10 @@ namespace tgui
 
     void Widget::mouseLeftWidget()
     {
-        if (m_CallbackFunctions[MouseLeft].empty() == false)
+        if (m_WidgetPhase & WidgetPhase_Hover)
+            appearanceChanged();
+
+        if (isCallbackBound(MouseLeft))
         {
             m_Callback.trigger = MouseLeft;
             addCallback();
@@ -316,6 +462,61 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::boundsChanged()
+    {
+        appearanceChanged();
+
+        // Only the parent keeps an index of the bounds of this widget
+        if (m_Parent)
+            static_cast<Widget*>(m_Parent)->childBoundsChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::childBoundsChanged()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::focusableChanged()
+    {
+        // Only the parent has this widget in its focus chain
+        if (m_Parent)
+            static_cast<Widget*>(m_Parent)->childFocusableChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::childFocusableChanged()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::appearanceChanged()
+    {
+        // The parent is called through the base class, because Container doesn't make its version accessible to widgets
+        if (m_Parent)
+            static_cast<Widget*>(m_Parent)->appearanceChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::getMouseBounds(sf::FloatRect&) const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::getDrawBounds(sf::FloatRect&) const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(float, float)
     {
     }
@@ -358,7 +559,7 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
-        if (m_CallbackFunctions[Focused].empty() == false)
+        if (isCallbackBound(Focused))
         {
             m_Callback.trigger = Focused;
             addCallback();
@@ -373,7 +574,7 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
-        if (m_CallbackFunctions[Unfocused].empty() == false)
+        if (isCallbackBound(Unfocused))
         {
             m_Callback.trigger = Unfocused;
             addCallback();
@@ -506,13 +707,13 @@ namespace tgui
         {
             std::vector<sf::String> callbacks;
 
-            if ((m_CallbackFunctions.find(Focused) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Focused).size() == 1) && (m_CallbackFunctions.at(Focused).front() == nullptr))
+            if (isOnlyBoundToParent(Focused))
                 callbacks.push_back("Focused");
-            if ((m_CallbackFunctions.find(Unfocused) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(Unfocused).size() == 1) && (m_CallbackFunctions.at(Unfocused).front() == nullptr))
+            if (isOnlyBoundToParent(Unfocused))
                 callbacks.push_back("Unfocused");
-            if ((m_CallbackFunctions.find(MouseEntered) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MouseEntered).size() == 1) && (m_CallbackFunctions.at(MouseEntered).front() == nullptr))
+            if (isOnlyBoundToParent(MouseEntered))
                 callbacks.push_back("MouseEntered");
-            if ((m_CallbackFunctions.find(MouseLeft) != m_CallbackFunctions.end()) && (m_CallbackFunctions.at(MouseLeft).size() == 1) && (m_CallbackFunctions.at(MouseLeft).front() == nullptr))
+            if (isOnlyBoundToParent(MouseLeft))
                 callbacks.push_back("MouseLeft");
 
             encodeList(callbacks, value);
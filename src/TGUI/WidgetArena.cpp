@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//                         Koushtav Chakrabarty (koushtav@fleptic.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/WidgetArena.hpp>
+
+#include <new>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::WidgetArena(std::size_t blockSize) :
+        m_BlockSize     (blockSize),
+        m_BlockPosition (nullptr),
+        m_BlockRemaining(0),
+        m_Allocations   (0),
+        m_References    (0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    WidgetArena::~WidgetArena()
+    {
+        releaseBlocks();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* WidgetArena::allocate(std::size_t size)
+    {
+        size = (size + Granularity - 1) / Granularity * Granularity;
+
+        // Large widgets don't fit nicely in the blocks
+        if (size > m_BlockSize / 8)
+        {
+            ++m_Allocations;
+            return ::operator new(size);
+        }
+
+        // Reuse the memory of a widget with the same size if there is one
+        std::size_t sizeClass = size / Granularity;
+        if ((sizeClass < m_FreeLists.size()) && (m_FreeLists[sizeClass] != nullptr))
+        {
+            void* memory = m_FreeLists[sizeClass];
+            m_FreeLists[sizeClass] = *static_cast<void**>(memory);
+
+            ++m_Allocations;
+            return memory;
+        }
+
+        // Start a new block when the current one is full
+        if (m_BlockRemaining < size)
+        {
+            m_Blocks.push_back(static_cast<char*>(::operator new(m_BlockSize)));
+            m_BlockPosition = m_Blocks.back();
+            m_BlockRemaining = m_BlockSize;
+        }
+
+        void* memory = m_BlockPosition;
+        m_BlockPosition += size;
+        m_BlockRemaining -= size;
+
+        ++m_Allocations;
+        return memory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetArena::deallocate(void* memory, std::size_t size)
+    {
+        size = (size + Granularity - 1) / Granularity * Granularity;
+
+        if (size > m_BlockSize / 8)
+        {
+            ::operator delete(memory);
+        }
+        else
+        {
+            std::size_t sizeClass = size / Granularity;
+            if (sizeClass >= m_FreeLists.size())
+                m_FreeLists.resize(sizeClass + 1, nullptr);
+
+            *static_cast<void**>(memory) = m_FreeLists[sizeClass];
+            m_FreeLists[sizeClass] = memory;
+        }
+
+        // When the last widget is gone, all memory is released at once
+        if (--m_Allocations == 0)
+        {
+            releaseBlocks();
+
+            if (m_References == 0)
+                delete this;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetArena::addReference()
+    {
+        ++m_References;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetArena::removeReference()
+    {
+        if ((--m_References == 0) && (m_Allocations == 0))
+            delete this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int WidgetArena::getAllocationCount() const
+    {
+        return m_Allocations;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WidgetArena::getBlockCount() const
+    {
+        return m_Blocks.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetArena::releaseBlocks()
+    {
+        for (unsigned int i = 0; i < m_Blocks.size(); ++i)
+            ::operator delete(m_Blocks[i]);
+
+        m_Blocks.clear();
+        m_FreeLists.clear();
+
+        m_BlockPosition = nullptr;
+        m_BlockRemaining = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
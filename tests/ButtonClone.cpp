@@ -0,0 +1,62 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <iostream>
+
+#include <TGUI/TGUI.hpp>
+
+#include "Check.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    const unsigned int cloneCount = 10000;
+
+    tgui::Button::Ptr button;
+    check(button->load(TGUI_WIDGETS_FOLDER "Black.conf"), "the button can be loaded");
+
+    const unsigned int textureCount = tgui::TGUI_TextureManager.getTextureCount();
+
+    // The clones share the textures of the original button, copying and releasing them should not touch the graphics card
+    sf::Clock clock;
+    {
+        std::vector<tgui::Button::Ptr> clones;
+        clones.reserve(cloneCount);
+        for (unsigned int i = 0; i < cloneCount; ++i)
+            clones.push_back(button.clone());
+
+        check(tgui::TGUI_TextureManager.getTextureCount() == textureCount, "cloning a button creates no new textures");
+        check(clones.back()->getSize() == button->getSize(), "the clones look the same as the original button");
+    }
+
+    const float time = static_cast<float>(clock.getElapsedTime().asMicroseconds()) / cloneCount;
+    std::cout << "Button::clone: " << time << " us per button to clone and release " << cloneCount << " buttons" << std::endl;
+
+    check(tgui::TGUI_TextureManager.getTextureCount() == textureCount, "releasing the clones keeps the textures of the original");
+
+    return finishChecks("button clone");
+}
@@ -0,0 +1,89 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <iostream>
+
+#include <TGUI/TGUI.hpp>
+
+#include "Check.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Loads the buttons and returns the average time per button in microseconds
+    float loadButtons(std::vector<tgui::Button::Ptr>& buttons, unsigned int count)
+    {
+        bool loaded = true;
+        sf::Clock clock;
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            buttons.push_back(tgui::Button::Ptr());
+            loaded = buttons.back()->load(TGUI_WIDGETS_FOLDER "Black.conf") && loaded;
+        }
+
+        const float time = static_cast<float>(clock.getElapsedTime().asMicroseconds()) / count;
+        check(loaded, "all buttons can be loaded");
+        return time;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    const unsigned int buttonCount = 500;
+
+    // The first button reads the config file and the image, the others are loaded from the cache
+    {
+        std::vector<tgui::Button::Ptr> buttons;
+        const float firstTime = loadButtons(buttons, 1);
+        const float cachedTime = loadButtons(buttons, buttonCount);
+
+        std::cout << "Button::load: " << firstTime << " us for the first button, "
+                  << cachedTime << " us per button for the next " << buttonCount << " buttons" << std::endl;
+
+        check(buttons.front()->getSize() == buttons.back()->getSize(), "cached buttons look the same as the first one");
+    }
+
+    // The image was removed together with the last button, the cached values have to find it again
+    {
+        std::vector<tgui::Button::Ptr> buttons;
+        loadButtons(buttons, 2);
+        check(tgui::TGUI_TextureManager.getTextureCount() > 0, "the image is loaded again after the last button was removed");
+    }
+
+    // Flushing the cache forgets the config files and the images
+    tgui::ConfigFile::flushCache();
+    check(tgui::TGUI_TextureManager.getTextureCount() == 0, "no textures remain when no button uses them");
+
+    {
+        std::vector<tgui::Button::Ptr> buttons;
+        loadButtons(buttons, 2);
+    }
+
+    return finishChecks("button load");
+}
@@ -0,0 +1,185 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+
+#include "Check.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    void click(const tgui::Picture::Ptr& picture)
+    {
+        picture->leftMousePressed(0, 0);
+        picture->leftMouseReleased(0, 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    // Functions that are bound while the callback is being sent are only called for the next callback
+    {
+        tgui::Picture::Ptr picture;
+        unsigned int newFunctionCalls = 0;
+        bool bound = false;
+
+        picture->bindCallback([&]()
+            {
+                if (bound)
+                    return;
+
+                // Binding this many functions makes the list grow while it is being handled
+                for (unsigned int i = 0; i < 100; ++i)
+                    picture->bindCallback([&]() { ++newFunctionCalls; }, tgui::Picture::LeftMouseClicked);
+
+                bound = true;
+            }, tgui::Picture::LeftMouseClicked);
+
+        click(picture);
+        check(newFunctionCalls == 0, "functions bound during a callback are not called for that callback");
+
+        click(picture);
+        check(newFunctionCalls == 100, "functions bound during a callback are called for the next callback");
+    }
+
+    // Unbinding while the callback is being sent doesn't stop the functions that were already bound
+    {
+        tgui::Picture::Ptr picture;
+        unsigned int calls = 0;
+
+        picture->bindCallback([&]() { picture->unbindAllCallback(); }, tgui::Picture::LeftMouseClicked);
+        picture->bindCallback([&]() { ++calls; }, tgui::Picture::LeftMouseClicked);
+
+        click(picture);
+        check(calls == 1, "functions that were bound when the callback started are all called");
+
+        click(picture);
+        check(calls == 1, "unbound functions are no longer called");
+    }
+
+    // A callback that is caused by a function doesn't call the functions that were already unbound
+    {
+        tgui::Picture::Ptr picture;
+        unsigned int nestedCalls = 0;
+        bool nested = false;
+
+        picture->bindCallback([&]()
+            {
+                if (nested)
+                    return;
+
+                nested = true;
+                picture->unbindCallback(tgui::Picture::LeftMouseClicked);
+                picture->bindCallback([&]() { ++nestedCalls; }, tgui::Picture::LeftMouseClicked);
+                click(picture);
+            }, tgui::Picture::LeftMouseClicked);
+
+        click(picture);
+        check(nestedCalls == 0, "the callback that a function causes doesn't call functions that were bound or unbound by it");
+
+        click(picture);
+        check(nestedCalls == 1, "only the function that was bound last is called afterwards");
+    }
+
+    // Handlers that are connected while the signal is emitted are only called the next time
+    {
+        tgui::Signal<int> signal;
+        unsigned int newHandlerCalls = 0;
+        bool connected = false;
+
+        signal.connect([&](int)
+            {
+                if (connected)
+                    return;
+
+                // Connecting this many handlers would make the list reallocate while it is being handled
+                for (unsigned int i = 0; i < 100; ++i)
+                    signal.connect([&](int) { ++newHandlerCalls; });
+
+                connected = true;
+            });
+
+        signal(1);
+        check(newHandlerCalls == 0, "handlers connected while emitting are not called for that emit");
+
+        signal(2);
+        check(newHandlerCalls == 100, "handlers connected while emitting are called for the next emit");
+    }
+
+    // Handlers can disconnect themselves and others while the signal is emitted
+    {
+        tgui::Signal<int> signal;
+        unsigned int selfCalls = 0;
+        unsigned int otherCalls = 0;
+        unsigned int otherId = 0;
+        unsigned int selfId = 0;
+
+        selfId = signal.connect([&](int)
+            {
+                ++selfCalls;
+                signal.disconnect(selfId);
+                signal.disconnect(otherId);
+            });
+        otherId = signal.connect([&](int) { ++otherCalls; });
+
+        signal(1);
+        check((selfCalls == 1) && (otherCalls == 0), "disconnected handlers are no longer called during the emit");
+        check(signal.isEmpty(), "all handlers are disconnected");
+
+        signal(2);
+        check(selfCalls == 1, "disconnected handlers are not called for the next emit");
+    }
+
+    // Emitting the signal again from a handler doesn't call the handlers that were disconnected
+    {
+        tgui::Signal<int> signal;
+        unsigned int nestedCalls = 0;
+        unsigned int laterCalls = 0;
+
+        signal.connect([&](int depth)
+            {
+                if (depth == 0)
+                {
+                    signal.disconnectAll();
+                    signal.connect([&](int) { ++laterCalls; });
+                    signal(1);
+                }
+                else
+                    ++nestedCalls;
+            });
+
+        signal(0);
+        check((nestedCalls == 0) && (laterCalls == 0), "a nested emit calls neither disconnected nor newly connected handlers");
+
+        signal(0);
+        check(laterCalls == 1, "only the handler that was connected last is called afterwards");
+    }
+
+    return finishChecks("callback rebinding");
+}
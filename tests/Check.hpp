@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TESTS_CHECK_HPP
+#define TGUI_TESTS_CHECK_HPP
+
+#include <iostream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Every test is a single source file, so the counter can live in an unnamed namespace without being shared between programs.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The amount of checks that failed so far
+    unsigned int failures = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Prints the description of the check when the condition doesn't hold
+    void check(bool condition, const char* description)
+    {
+        if (!condition)
+        {
+            std::cerr << "FAILED: " << description << std::endl;
+            ++failures;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Returns the exit code of the test, which is only zero when none of the checks failed
+    int finishChecks(const char* testName)
+    {
+        if (failures > 0)
+            return 1;
+
+        std::cout << "All " << testName << " checks passed" << std::endl;
+        return 0;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TESTS_CHECK_HPP
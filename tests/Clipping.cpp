@@ -0,0 +1,81 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+
+#include "Check.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Checks that something was drawn and that all of it was clipped to the given area
+    void checkClipArea(const tgui::RecordingTarget& target, const sf::IntRect& area, const char* description)
+    {
+        const std::vector<tgui::RecordingTarget::DrawCommand>& commands = target.getDrawCommands();
+
+        bool clipped = !commands.empty();
+        for (unsigned int i = 0; i < commands.size(); ++i)
+        {
+            if (commands[i].clipArea != area)
+                clipped = false;
+        }
+
+        check(clipped, description);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    tgui::RecordingTarget target(800, 600);
+
+    tgui::Panel::Ptr panel;
+    panel->setPosition(10, 20);
+    panel->setSize(100, 50);
+    panel->setBackgroundColor(sf::Color::Red);
+
+    // A panel that is drawn without gui still clips itself
+    target.beginFrame();
+    target.draw(*panel);
+    checkClipArea(target, sf::IntRect(10, 20, 100, 50), "a panel drawn without gui is clipped");
+
+    tgui::Gui gui(target);
+    gui.add(panel);
+    check(gui.getClipArea() == sf::IntRect(0, 0, 800, 600), "the gui draws on the whole target by default");
+
+    // The clipping area of the application lies below the areas of the widgets
+    gui.setClipArea(sf::IntRect(0, 0, 50, 40));
+    gui.draw();
+    checkClipArea(target, sf::IntRect(10, 20, 40, 20), "the widgets stay inside the clipping area of the application");
+
+    gui.resetClipArea();
+    gui.draw();
+    checkClipArea(target, sf::IntRect(10, 20, 100, 50), "the whole target is used again after resetting the clipping area");
+
+    return finishChecks("clipping");
+}
@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+
+#include "Check.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    void moveMouse(tgui::Gui& gui, int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        gui.handleEvent(event);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    tgui::RecordingTarget target(800, 600);
+    tgui::Gui gui(target);
+    gui.setMouseMoveCoalescing(false);
+
+    tgui::Label::Ptr label(gui);
+    label->setAutoSize(false);
+    label->setPosition(10, 10);
+    label->setSize(200, 50);
+    label->setText("Static");
+
+    tgui::Button::Ptr button(gui);
+    check(button->load(TGUI_WIDGETS_FOLDER "Black.conf"), "the button can be loaded");
+    button->setPosition(10, 100);
+    button->setSize(200, 50);
+
+    gui.draw();
+    check(!gui.needsRedraw(), "drawing the gui clears the redraw flag");
+
+    // A label looks the same whether the mouse is on top of it or not
+    moveMouse(gui, 20, 20);
+    check(!gui.needsRedraw(), "moving the mouse onto a label doesn't require a redraw");
+
+    moveMouse(gui, 30, 30);
+    check(!gui.needsRedraw(), "moving the mouse on top of a label doesn't require a redraw");
+
+    moveMouse(gui, 500, 500);
+    check(!gui.needsRedraw(), "moving the mouse away from a label doesn't require a redraw");
+
+    moveMouse(gui, 600, 500);
+    check(!gui.needsRedraw(), "moving the mouse where there are no widgets doesn't require a redraw");
+
+    // The button has a hover image, so entering and leaving it does change what is drawn
+    moveMouse(gui, 20, 110);
+    check(gui.needsRedraw(), "moving the mouse onto a button requires a redraw");
+    gui.draw();
+
+    moveMouse(gui, 30, 120);
+    check(!gui.needsRedraw(), "moving the mouse on top of a button doesn't require another redraw");
+
+    moveMouse(gui, 500, 500);
+    check(gui.needsRedraw(), "moving the mouse away from a button requires a redraw");
+    gui.draw();
+
+    return finishChecks("redraw tracking");
+}
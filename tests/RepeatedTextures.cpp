@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+
+#include "Check.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    const std::string filename = TGUI_WIDGETS_FOLDER "Black.png";
+    const sf::IntRect middle(50, 25, 100, 50);
+
+    // Repeating the same part of an image shares one texture, no matter how many widgets repeat it
+    {
+        tgui::Texture first;
+        tgui::Texture second;
+        tgui::Texture notRepeated;
+        check(tgui::TGUI_TextureManager.getTexture(filename, first, middle), "the image can be loaded");
+        check(tgui::TGUI_TextureManager.getTexture(filename, second, middle), "the image can be loaded twice");
+        check(tgui::TGUI_TextureManager.getTexture(filename, notRepeated, middle), "the image can be loaded three times");
+
+        first.setRepeated(true);
+        const unsigned int textureCount = tgui::TGUI_TextureManager.getTextureCount();
+
+        second.setRepeated(true);
+        check(tgui::TGUI_TextureManager.getTextureCount() == textureCount, "repeating the part again doesn't create a texture");
+        check(first.sprite.getTexture() == second.sprite.getTexture(), "the repeated textures are shared");
+        check(first.isRepeated() && second.isRepeated(), "the shared texture is repeated");
+        check(!notRepeated.isRepeated(), "the texture that wasn't repeated is still shared with the rest of the image");
+        check(first.sprite.getTextureRect() == sf::IntRect(0, 0, middle.width, middle.height), "the repeated texture only contains the part");
+
+        second.setRepeated(false);
+        check(!second.isRepeated() && first.isRepeated(), "repeating can be turned off without affecting other textures");
+
+        tgui::TGUI_TextureManager.removeTexture(first);
+        tgui::TGUI_TextureManager.removeTexture(second);
+        tgui::TGUI_TextureManager.removeTexture(notRepeated);
+    }
+
+    // The middle images of a config file are repeated from a texture that was made while loading the theme
+    {
+        std::vector<tgui::Button::Ptr> buttons;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            buttons.push_back(tgui::Button::Ptr());
+            check(buttons.back()->load(TGUI_WIDGETS_FOLDER "Black.conf"), "the button can be loaded");
+        }
+
+        const unsigned int textureCount = tgui::TGUI_TextureManager.getTextureCount();
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            tgui::Button::Ptr button;
+            button->load(TGUI_WIDGETS_FOLDER "Black.conf");
+        }
+
+        check(tgui::TGUI_TextureManager.getTextureCount() == textureCount, "loading more buttons doesn't create textures");
+    }
+
+    return finishChecks("repeated texture");
+}
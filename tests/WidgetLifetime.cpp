@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+
+#include "Check.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Changing a widget makes it notify its parent, which may no longer exist when the widget was removed from it
+    void useAfterContainerIsGone(const tgui::Picture::Ptr& picture, const char* description)
+    {
+        check(picture->getParent() == nullptr, description);
+
+        picture->setPosition(10, 20);
+        picture->hide();
+        picture->show();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    // Removed with remove(widget)
+    {
+        tgui::Picture::Ptr picture;
+        {
+            tgui::Panel::Ptr panel;
+            panel->add(picture);
+            panel->remove(picture);
+        }
+        useAfterContainerIsGone(picture, "remove clears the parent");
+    }
+
+    // Removed together with other widgets
+    {
+        tgui::Picture::Ptr picture;
+        {
+            tgui::Panel::Ptr panel;
+            tgui::Picture::Ptr other(*panel);
+            panel->add(picture);
+
+            std::vector<tgui::Widget::Ptr> widgets;
+            widgets.push_back(picture);
+            widgets.push_back(other);
+            panel->remove(widgets);
+        }
+        useAfterContainerIsGone(picture, "removing a list of widgets clears the parent");
+    }
+
+    // Removed with removeAllWidgets
+    {
+        tgui::Picture::Ptr picture;
+        {
+            tgui::Panel::Ptr panel;
+            panel->add(picture);
+            panel->removeAllWidgets();
+        }
+        useAfterContainerIsGone(picture, "removeAllWidgets clears the parent");
+    }
+
+    // Never removed, the container is simply destroyed
+    {
+        tgui::Picture::Ptr picture;
+        {
+            tgui::Panel::Ptr panel;
+            panel->add(picture);
+        }
+        useAfterContainerIsGone(picture, "destroying the container clears the parent");
+    }
+
+    // Inside a nested container, which is destroyed together with its parent
+    {
+        tgui::Picture::Ptr picture;
+        {
+            tgui::Panel::Ptr outer;
+            tgui::Panel::Ptr inner(*outer);
+            inner->add(picture);
+        }
+        useAfterContainerIsGone(picture, "destroying the parent of the container clears the parent");
+    }
+
+    // Functions that tell the parent about the widget can still be called after the widget was removed from it
+    {
+        tgui::Panel::Ptr panel;
+        tgui::RadioButton::Ptr radioButton(*panel);
+        tgui::RadioButton::Ptr otherRadioButton(*panel);
+        tgui::ChildWindow::Ptr childWindow(*panel);
+        tgui::Picture::Ptr picture(*panel);
+        panel->setSize(200, 100);
+
+        otherRadioButton->check();
+        panel->remove(radioButton);
+        radioButton->check();
+        check(radioButton->isChecked(), "a removed radio button can be checked");
+        check(otherRadioButton->isChecked(), "checking a removed radio button doesn't affect its old parent");
+
+        childWindow->keepInParent(true);
+        panel->remove(childWindow);
+        childWindow->setPosition(500, 500);
+        check(childWindow->getPosition() == sf::Vector2f(500, 500), "a removed child window no longer stays inside its old parent");
+        childWindow->leftMousePressed(500, 500);
+        childWindow->destroy();
+
+        panel->remove(picture);
+        picture->moveToFront();
+        picture->moveToBack();
+        check(panel->getWidgets().size() == 1, "moving a removed widget doesn't add it to its old parent again");
+    }
+
+    return finishChecks("widget lifetime");
+}
@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+
+#include "Check.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Checks that the widgets and their names are listed from back to front in the given order
+    void checkOrder(tgui::Panel::Ptr& panel, const std::vector<tgui::Widget::Ptr>& widgets, const char* description)
+    {
+        const std::vector<tgui::Widget::Ptr>& list = panel->getWidgets();
+        const std::vector<sf::String>& names = panel->getWidgetNames();
+
+        bool correct = (list.size() == widgets.size()) && (names.size() == widgets.size());
+        for (unsigned int i = 0; correct && (i < widgets.size()); ++i)
+        {
+            std::string name;
+            correct = (list[i] == widgets[i]) && panel->getWidgetName(widgets[i], name) && (names[i] == name);
+        }
+
+        check(correct, description);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    // Removing and reordering keeps the order of the other widgets
+    {
+        tgui::Panel::Ptr panel;
+        tgui::Picture::Ptr a(*panel, "a");
+        tgui::Picture::Ptr b(*panel, "b");
+        tgui::Picture::Ptr c(*panel, "c");
+
+        a->moveToFront();
+        checkOrder(panel, {b, c, a}, "moving a widget to the front");
+
+        c->moveToBack();
+        checkOrder(panel, {c, b, a}, "moving a widget to the back");
+
+        panel->remove(b);
+        checkOrder(panel, {c, a}, "removing a widget");
+
+        tgui::Picture::Ptr d(*panel, "d");
+        checkOrder(panel, {c, a, d}, "a new widget is added in front, also in the slot of a removed widget");
+
+        panel->moveWidgetToFront(c.get());
+        panel->moveWidgetToBack(d.get());
+        panel->remove(a);
+        checkOrder(panel, {d, c}, "several changes before the list is requested");
+
+        check(panel->setWidgetName(c, "e") && (panel->get("e") == c) && (panel->get("c") == nullptr), "renaming a widget");
+        checkOrder(panel, {d, c}, "renaming a widget doesn't change the order");
+
+        panel->remove(panel->getWidgets());
+        check(panel->getWidgets().empty() && (c->getParent() == nullptr), "removing the list returned by getWidgets");
+    }
+
+    // Of the widgets with the same name, the one in the back is found
+    {
+        tgui::Panel::Ptr panel;
+        tgui::Picture::Ptr first(*panel, "name");
+        tgui::Picture::Ptr second(*panel, "name");
+        tgui::Picture::Ptr third(*panel, "name");
+        check(panel->get("name") == first, "the first widget is found");
+
+        first->moveToFront();
+        check(panel->get("name") == second, "the next widget is found after moving the first one to the front");
+
+        third->moveToBack();
+        check(panel->get("name") == third, "the widget that was moved to the back is found");
+
+        panel->remove(third);
+        check(panel->get("name") == second, "the next widget is found after removing the first one");
+
+        panel->setWidgetName(second, "other");
+        check(panel->get("name") == first, "the next widget is found after renaming the first one");
+
+        panel->setWidgetName(second, "name");
+        check(panel->get("name") == second, "a renamed widget is found when it lies in the back");
+
+        panel->remove(first);
+        panel->remove(second);
+        check(panel->get("name") == nullptr, "nothing is found after removing all widgets with the name");
+    }
+
+    // The focused widget stays focused while the other widgets are removed or reordered
+    {
+        tgui::Panel::Ptr panel;
+        tgui::Panel::Ptr first(*panel);
+        tgui::Panel::Ptr second(*panel);
+        tgui::Panel::Ptr third(*panel);
+
+        panel->focusWidget(second);
+        first->moveToFront();
+        third->moveToBack();
+        panel->remove(first);
+        check(second->isFocused(), "the focused widget keeps the focus");
+
+        panel->focusNextWidget();
+        check(third->isFocused(), "the next widget in the focus chain follows the new order");
+    }
+
+    // Removed widgets are destroyed right away, even when the sorted list still has to be rebuilt
+    {
+        tgui::Panel::Ptr panel;
+        tgui::WeakWidgetPtr<tgui::Picture> first;
+        tgui::WeakWidgetPtr<tgui::Picture> second;
+        {
+            tgui::Picture::Ptr a(*panel);
+            tgui::Picture::Ptr b(*panel);
+            tgui::Picture::Ptr c(*panel);
+            first = a;
+            second = b;
+
+            panel->getWidgets();
+            panel->remove(a);
+            c->moveToBack();
+            panel->remove(b);
+        }
+
+        check(first.expired() && second.expired(), "the container doesn't keep removed widgets alive");
+        check(panel->getWidgets().size() == 1, "the removed widgets are no longer listed");
+    }
+
+    return finishChecks("widget order");
+}